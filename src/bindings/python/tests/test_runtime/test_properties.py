@@ -207,6 +207,7 @@ def test_properties_ro(ov_property_ro, expected_value):
             ((properties.Affinity.NONE, properties.Affinity.NONE),),
         ),
         (properties.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True),)),
+        (properties.enable_mmap, "ENABLE_MMAP", ((True, True),)),
         (properties.inference_precision, "INFERENCE_PRECISION_HINT", ((Type.f32, Type.f32),)),
         (properties.hint.inference_precision, "INFERENCE_PRECISION_HINT", ((Type.f32, Type.f32),)),
         (
@@ -13,7 +13,9 @@ namespace pass {
 /**
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
- *        the result of a folded operation.
+ *        the result of a folded operation. The element-wise, Convert, Transpose and Gather operations over large
+ *        tensors are folded in several threads, the number of threads is limited by
+ *        OV_CONSTANT_FOLDING_NUM_THREADS environment variable (all the hardware threads by default).
  * @ingroup ov_pass_cpp_api
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "openvino/pass/pass.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
@@ -275,6 +278,34 @@ protected:
     bool m_enable_shape_inference = false;
 
     std::vector<std::shared_ptr<ov::pass::MatcherPass>> m_matchers;
+
+private:
+    friend class Manager;
+
+    /// \brief Rebuilds the index of the matchers by the root type if the set of the enabled matchers has changed
+    /// since the index was built.
+    void update_matcher_index();
+
+    /// \brief Returns the indices of the enabled matchers applicable to the node type (including the matchers
+    /// registered for the parent types) in the order of the registration.
+    const std::vector<size_t>& get_matchers_for_type(const DiscreteTypeInfo& type_info);
+
+    // the enabled flags of the matchers the index was built for
+    std::vector<bool> m_indexed_matchers;
+    // whether all the enabled matchers have a type based root node, so the index may be used
+    bool m_all_roots_have_type = false;
+    std::unordered_map<DiscreteTypeInfo, std::vector<size_t>> m_type_to_matcher;
+    // the matchers applicable to the node types met by the pass (the parent types included)
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> m_node_type_to_matchers;
+
+    // the time spent by every matcher pass, the number of the calls and of the successful ones, collected while the
+    // pass profiling is enabled and reported by the Manager with the time of the pass
+    struct MatcherProfile {
+        std::chrono::steady_clock::duration time{};
+        size_t calls = 0;
+        size_t hits = 0;
+    };
+    std::vector<MatcherProfile> m_matcher_profile;
 };
 
 class OPENVINO_API BackwardGraphRewrite : public GraphRewrite {
@@ -7,8 +7,10 @@
 #include <list>
 #include <memory>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
+#include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/pass.hpp"
 #include "openvino/pass/validate.hpp"
 
@@ -121,6 +123,8 @@ protected:
 
     std::shared_ptr<PassConfig> m_pass_config;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
+    // GraphRewrite containers of the registered MatcherPasses, kept between the runs with their matchers index
+    std::unordered_map<const MatcherPass*, std::shared_ptr<GraphRewrite>> m_matcher_pass_wrappers;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
 };
@@ -10,6 +10,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -97,6 +98,42 @@ void autobroadcast_binop(const T* arg0,
                          const Shape& arg1_shape,
                          const op::AutoBroadcastSpec& broadcast_spec,
                          Functor elementwise_functor) {
+    // the output is split along the outermost axis, so the parts may be computed in parallel
+    if (get_num_threads() > 1 && broadcast_spec.m_type != op::AutoBroadcastType::PDPD) {
+        const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+        Shape shape0(rank - arg0_shape.size(), 1);
+        Shape shape1(rank - arg1_shape.size(), 1);
+        shape0.insert(shape0.end(), arg0_shape.begin(), arg0_shape.end());
+        shape1.insert(shape1.end(), arg1_shape.begin(), arg1_shape.end());
+
+        const size_t outer = rank ? std::max(shape0[0], shape1[0]) : 1;
+        size_t inner = 1;
+        for (size_t i = 1; i < rank; i++) {
+            inner *= std::max(shape0[i], shape1[i]);
+        }
+        if (outer > 1 && inner > 0) {
+            const size_t inner0 = shape0[0] == 1 ? 0 : shape_size(shape0) / shape0[0];
+            const size_t inner1 = shape1[0] == 1 ? 0 : shape_size(shape1) / shape1[0];
+            parallel_for_range(outer, std::max<size_t>(parallel_min_chunk / inner, 1), [&](size_t begin, size_t end) {
+                ScopedNumThreads sequential(1);
+                Shape part0 = shape0;
+                Shape part1 = shape1;
+                if (shape0[0] != 1)
+                    part0[0] = end - begin;
+                if (shape1[0] != 1)
+                    part1[0] = end - begin;
+                autobroadcast_binop(arg0 + begin * inner0,
+                                    arg1 + begin * inner1,
+                                    out + begin * inner,
+                                    part0,
+                                    part1,
+                                    op::AutoBroadcastSpec(op::AutoBroadcastType::NUMPY),
+                                    elementwise_functor);
+            });
+            return;
+        }
+    }
+
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
         for (size_t i = 0; i < shape_size(arg0_shape); i++) {
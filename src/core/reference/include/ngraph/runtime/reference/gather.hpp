@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 
 #include "ngraph/shape.hpp"
+#include "utils/parallel.hpp"
 #include "utils/span.hpp"
 
 namespace ngraph {
@@ -32,28 +34,33 @@ void gather(const T* const data,
     int64_t batch_indices_mul = shape_size(span(indices_shape).subspan(batch_dims));
 
     int64_t axis_size = data_shape[axis];
-    int64_t data_offset, out_offset, idx;
-    // for out of bound indices is filled with zeros
-    std::fill(out, out + shape_size(out_shape), 0);
-
-    for (int64_t batch = 0; batch < batch_size; batch++)
-        for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++) {
-            data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-            out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
-            for (int64_t i = 0; i < indices_size; i++) {
-                idx = indices[i + batch_indices_mul * batch];
-                if (idx < 0)
-                    idx += axis_size;
-                // for out of bound values have to be filled with zeros
-                if (idx >= axis_size || idx < 0)
-                    continue;
-
-                const auto src_begin = std::next(data, data_offset + inner_size * idx);
-                const auto src_end = std::next(src_begin, inner_size);
-                const auto out_ptr = std::next(out, out_offset + inner_size * i);
-                std::copy(src_begin, src_end, out_ptr);
+
+    // the slices of the output are gathered in parallel
+    const int64_t slices = batch_size * outer_size * indices_size;
+    const size_t min_slices = std::max<size_t>(parallel_min_chunk / std::max<int64_t>(inner_size, 1), 1);
+    parallel_for_range(slices, min_slices, [&](size_t begin, size_t end) {
+        for (int64_t slice = begin; slice < static_cast<int64_t>(end); slice++) {
+            const int64_t i = slice % indices_size;
+            const int64_t outer_idx = slice / indices_size % outer_size;
+            const int64_t batch = slice / indices_size / outer_size;
+            const int64_t data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
+            const int64_t out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
+            const auto out_ptr = std::next(out, out_offset + inner_size * i);
+
+            int64_t idx = indices[i + batch_indices_mul * batch];
+            if (idx < 0)
+                idx += axis_size;
+            // for out of bound indices is filled with zeros
+            if (idx >= axis_size || idx < 0) {
+                std::fill(out_ptr, std::next(out_ptr, inner_size), 0);
+                continue;
             }
+
+            const auto src_begin = std::next(data, data_offset + inner_size * idx);
+            const auto src_end = std::next(src_begin, inner_size);
+            std::copy(src_begin, src_end, out_ptr);
         }
+    });
 }
 
 }  // namespace reference
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief The minimal number of elements processed by a thread of the parallel reference kernels, the smaller
+///        tensors are processed sequentially.
+constexpr size_t parallel_min_chunk = 32768;
+
+/// \brief Returns the number of threads the reference kernels may use in the calling thread.
+///
+/// The reference kernels are sequential unless the caller allows them to use more threads with ScopedNumThreads
+/// (e.g. the constant folding of the large weights).
+size_t get_num_threads();
+
+/// \brief Sets the number of threads the reference kernels may use in the calling thread for the scope lifetime.
+class ScopedNumThreads {
+public:
+    explicit ScopedNumThreads(size_t num_threads);
+    ~ScopedNumThreads();
+
+    ScopedNumThreads(const ScopedNumThreads&) = delete;
+    ScopedNumThreads& operator=(const ScopedNumThreads&) = delete;
+
+private:
+    size_t m_prev_num_threads;
+};
+
+/// \brief Splits the range [0, work_amount) into contiguous chunks and calls func(begin, end) for every chunk.
+///
+/// The chunks are processed in parallel if the calling thread may use several threads and every thread gets at least
+/// min_chunk items of work, otherwise func is called once for the whole range. The kernels called inside func are
+/// sequential. The first exception thrown by func is rethrown once all the chunks are processed.
+///
+/// \param work_amount The number of items of work.
+/// \param min_chunk The minimal number of items processed by a thread.
+/// \param func The functor accepting the range of items [begin, end).
+template <typename Func>
+void parallel_for_range(size_t work_amount, size_t min_chunk, const Func& func) {
+    const size_t num_threads = std::min(get_num_threads(), work_amount / std::max<size_t>(min_chunk, 1));
+    if (num_threads <= 1) {
+        func(size_t{0}, work_amount);
+        return;
+    }
+
+    const size_t chunk = (work_amount + num_threads - 1) / num_threads;
+    std::vector<std::exception_ptr> errors(num_threads);
+    auto run_chunk = [&](size_t thread_idx) {
+        ScopedNumThreads sequential(1);
+        try {
+            const size_t begin = std::min(thread_idx * chunk, work_amount);
+            func(begin, std::min(begin + chunk, work_amount));
+        } catch (...) {
+            errors[thread_idx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (size_t i = 1; i < num_threads; ++i) {
+        try {
+            workers.emplace_back(run_chunk, i);
+        } catch (...) {
+            // no more threads available, the rest of the chunks is processed by the calling thread
+            for (; i < num_threads; ++i) {
+                run_chunk(i);
+            }
+        }
+    }
+    run_chunk(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
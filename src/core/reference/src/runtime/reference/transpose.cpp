@@ -4,17 +4,60 @@
 
 #include "ngraph/runtime/reference/transpose.hpp"
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
+#include <cstring>
 #include <numeric>
 #include <vector>
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+namespace {
+// copies the rows [begin, end) of the output, the row is the innermost dimension of the output
+void transpose_rows(const char* data,
+                    char* out,
+                    const Shape& out_shape,
+                    const std::vector<size_t>& in_strides,
+                    size_t element_size,
+                    size_t begin,
+                    size_t end) {
+    const size_t rank = out_shape.size();
+    const size_t row_size = out_shape[rank - 1];
+    const size_t row_stride = in_strides[rank - 1] * element_size;
+
+    // the coordinate of the first row and the offset of its first element in the input
+    std::vector<size_t> coord(rank, 0);
+    size_t in_offset = 0;
+    for (size_t i = rank - 1, row = begin; i > 0; --i) {
+        coord[i - 1] = row % out_shape[i - 1];
+        row /= out_shape[i - 1];
+        in_offset += coord[i - 1] * in_strides[i - 1];
+    }
+
+    out += begin * row_size * element_size;
+    for (size_t row = begin; row < end; ++row) {
+        const char* in = data + in_offset * element_size;
+        for (size_t j = 0; j < row_size; ++j, in += row_stride, out += element_size) {
+            std::memcpy(out, in, element_size);
+        }
+        // move to the next row
+        for (size_t i = rank - 1; i > 0; --i) {
+            in_offset += in_strides[i - 1];
+            if (++coord[i - 1] < out_shape[i - 1])
+                break;
+            in_offset -= coord[i - 1] * in_strides[i - 1];
+            coord[i - 1] = 0;
+        }
+    }
+}
+}  // namespace
+
 void transpose(const char* data,
                char* out,
                const Shape& data_shape,
@@ -24,7 +67,30 @@ void transpose(const char* data,
     // To reuse opt_kernel::reshape axes order vector has to be converted to AxisVector
     // Negative axes are not supported, it is validated by transpose evaluate method
     std::vector<size_t> axis_vector(axes_order, axes_order + data_shape.size());
-    runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+
+    const size_t count = shape_size(out_shape);
+    if (get_num_threads() == 1 || out_shape.empty() || count < 2 * parallel_min_chunk) {
+        runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+        return;
+    }
+
+    // the strides of the input along the output axes
+    const size_t rank = data_shape.size();
+    std::vector<size_t> data_strides(rank, 1);
+    for (size_t i = rank - 1; i > 0; --i) {
+        data_strides[i - 1] = data_strides[i] * data_shape[i];
+    }
+    std::vector<size_t> in_strides(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        in_strides[i] = data_strides[axis_vector[i]];
+    }
+
+    const size_t row_size = out_shape.back();
+    parallel_for_range(count / row_size,
+                       std::max<size_t>(parallel_min_chunk / row_size, 1),
+                       [&](size_t begin, size_t end) {
+                           transpose_rows(data, out, out_shape, in_strides, element_size, begin, end);
+                       });
 }
 }  // namespace reference
 }  // namespace runtime
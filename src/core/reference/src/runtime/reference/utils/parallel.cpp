@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace {
+size_t& current_num_threads() {
+    static thread_local size_t num_threads = 1;
+    return num_threads;
+}
+}  // namespace
+
+size_t get_num_threads() {
+    return current_num_threads();
+}
+
+ScopedNumThreads::ScopedNumThreads(size_t num_threads) : m_prev_num_threads(current_num_threads()) {
+    current_num_threads() = std::max<size_t>(num_threads, 1);
+}
+
+ScopedNumThreads::~ScopedNumThreads() {
+    current_num_threads() = m_prev_num_threads;
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
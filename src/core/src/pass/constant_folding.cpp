@@ -4,8 +4,11 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
 #include <openvino/cc/pass/itt.hpp>
+#include <thread>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
@@ -13,6 +16,7 @@
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/util/env_util.hpp"
 
 using namespace std;
 
@@ -51,9 +55,31 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Get the number of threads the reference kernels may use to fold the constants.
+ *
+ * The number is set by OV_CONSTANT_FOLDING_NUM_THREADS environment variable, all the hardware threads are used
+ * if it is not set or is not positive.
+ *
+ * \return Number of threads.
+ */
+const auto folding_num_threads = []() -> size_t {
+    static const size_t num_threads = []() -> size_t {
+        const auto env_threads = ov::util::getenv_int("OV_CONSTANT_FOLDING_NUM_THREADS", 0);
+        if (env_threads > 0) {
+            return static_cast<size_t>(env_threads);
+        }
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }();
+    return num_threads;
+};
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
+    // the large constants (e.g. the decompressed weights) are computed by the parallel reference kernels
+    ngraph::runtime::reference::ScopedNumThreads folding_threads(folding_num_threads());
+
     bool rewritten = pre_calculated_values_folding(model);
 
     for (const auto& node : model->get_ordered_ops()) {
@@ -5,6 +5,7 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
@@ -17,6 +18,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -86,24 +88,29 @@ bool ov::pass::GraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
     return apply_matcher_passes(f, std::move(nodes_to_run));
 }
 
-bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
-                                                  std::deque<std::weak_ptr<Node>> nodes_to_run) {
-    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::GraphRewrite::apply_matcher_passes");
-
-    bool rewritten = false;
+void ov::pass::GraphRewrite::update_matcher_index() {
     const auto& pass_config = get_pass_config();
+    std::vector<bool> enabled_matchers(m_matchers.size());
+    for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
+        enabled_matchers[matcher_index] = !pass_config->is_disabled(m_matchers[matcher_index]->get_type_info());
+    }
+    if (enabled_matchers == m_indexed_matchers)
+        return;
+
+    m_indexed_matchers = std::move(enabled_matchers);
+    m_type_to_matcher.clear();
+    m_node_type_to_matchers.clear();
 
     // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
-    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    m_all_roots_have_type = true;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
-        if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
+        if (!m_indexed_matchers[matcher_index])
             continue;
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
+            m_all_roots_have_type = false;
             break;
         }
 
@@ -121,24 +128,60 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
             if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
                 for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
+                    m_type_to_matcher[root_type_info].push_back(matcher_index);
                 }
             } else {
-                all_roots_has_type = false;
+                m_all_roots_have_type = false;
                 break;
             }
         } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            m_type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
+    }
+}
+
+const std::vector<size_t>& ov::pass::GraphRewrite::get_matchers_for_type(const DiscreteTypeInfo& type_info) {
+    auto cached = m_node_type_to_matchers.find(&type_info);
+    if (cached != m_node_type_to_matchers.end())
+        return cached->second;
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
+    // collect the matchers registered for the type and its parents and sort them in order of the registration,
+    // the list is kept for the next nodes of the same type
+    std::vector<size_t> matcher_passes_to_run;
+    for (const DiscreteTypeInfo* node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+        auto matchers = m_type_to_matcher.find(*node_type_info);
+        if (matchers != m_type_to_matcher.end()) {
+            matcher_passes_to_run.insert(matcher_passes_to_run.end(), matchers->second.begin(), matchers->second.end());
+        }
+    }
+    std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+    matcher_passes_to_run.erase(std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                                matcher_passes_to_run.end());
+    return m_node_type_to_matchers.emplace(&type_info, std::move(matcher_passes_to_run)).first->second;
+}
+
+bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
+                                                  std::deque<std::weak_ptr<Node>> nodes_to_run) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::GraphRewrite::apply_matcher_passes");
+
+    static const bool profile_enabled =
+        ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+
+    bool rewritten = false;
+    const auto& pass_config = get_pass_config();
+
+    // the index is kept between the runs (e.g. for the sub-graphs) while the enabled matchers are the same
+    update_matcher_index();
+
+    if (profile_enabled) {
+        m_matcher_profile.resize(m_matchers.size());
     }
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -151,7 +194,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status;
+        if (profile_enabled) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            auto& matcher_profile = m_matcher_profile[matcher_index];
+            matcher_profile.time += std::chrono::steady_clock::now() - start;
+            matcher_profile.calls++;
+            matcher_profile.hits += status;
+        } else {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -167,9 +220,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -194,29 +244,9 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         }
         // If all Matchers in MatcherPasses has type based root node then we apply efficient
         // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
+        if (m_all_roots_have_type) {
+            for (size_t matcher_index : get_matchers_for_type(node->get_type_info())) {
+                if (run_matcher_pass(matcher_index, node)) {
                     rewritten = true;
                     break;
                 }
@@ -224,18 +254,19 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         }
         // Otherwise we use default algorithm that iterates over all registered matcher passes
         else {
-            for (auto& m_pass : m_matchers) {
+            for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
                 // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
+                if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
                     continue;
 
-                if (run_matcher_pass(m_pass, node)) {
+                if (run_matcher_pass(matcher_index, node)) {
                     rewritten = true;
                     break;
                 }
             }
         }
     }
+
     return rewritten;
 }
 
@@ -5,6 +5,7 @@
 #include "ngraph/pass/manager.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -75,6 +76,8 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
         pass_timer.start();
 
+        // the profile of the matchers is reported with the time of the pass
+        std::shared_ptr<GraphRewrite> graph_rewrite;
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -83,9 +86,14 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                              << "model is dynamic. Skipping this transformation";
                 continue;
             }
-            // GraphRewrite is a temporary container for MatcherPass to make execution
-            // on on entire ngraph::Function
-            function_changed = GraphRewrite(matcher_pass).run_on_model(func);
+            // GraphRewrite is a container for MatcherPass to make execution on entire ngraph::Function,
+            // it's kept with the index of the matchers for the next runs
+            auto& wrapper = m_matcher_pass_wrappers[matcher_pass.get()];
+            if (!wrapper) {
+                wrapper = std::make_shared<GraphRewrite>(matcher_pass);
+            }
+            graph_rewrite = wrapper;
+            function_changed = graph_rewrite->run_on_model(func);
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -101,6 +109,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                     function_changed = false;
                 }
             } else {
+                graph_rewrite = dynamic_pointer_cast<GraphRewrite>(function_pass);
                 function_changed = function_pass->run_on_model(func);
             }
         } else if (auto node_pass = dynamic_pointer_cast<ngraph::pass::NodePass>(pass)) {
@@ -131,6 +140,18 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         pass_timer.stop();
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            if (graph_rewrite) {
+                auto& matcher_profile = graph_rewrite->m_matcher_profile;
+                for (size_t matcher_index = 0; matcher_index < matcher_profile.size(); ++matcher_index) {
+                    const auto& profile = matcher_profile[matcher_index];
+                    if (!profile.calls)
+                        continue;
+                    cout << setw(7) << chrono::duration_cast<chrono::milliseconds>(profile.time).count() << "ms   "
+                         << graph_rewrite->m_matchers[matcher_index]->get_name() << " (" << profile.calls
+                         << " calls, " << profile.hits << " applied)\n";
+                }
+                matcher_profile.clear();
+            }
         }
     }
     if (profile_enabled) {
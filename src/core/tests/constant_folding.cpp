@@ -3584,3 +3584,42 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+TEST(constant_folding, fold_large_decompression_subgraph) {
+    // the tensors are large enough to be folded in several threads
+    const size_t rows = 256, cols = 512;
+    vector<float16> weights(rows * cols);
+    vector<float> scales(rows);
+    for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] = static_cast<float>(i % 16);
+    }
+    for (size_t i = 0; i < rows; i++) {
+        scales[i] = static_cast<float>(i % 4 + 1);
+    }
+    auto weights_const = make_shared<op::Constant>(element::f16, Shape{rows, cols}, weights);
+    auto convert = make_shared<op::v0::Convert>(weights_const, element::f32);
+    auto scales_const = make_shared<op::Constant>(element::f32, Shape{rows, 1}, scales);
+    auto multiply = make_shared<op::v1::Multiply>(convert, scales_const);
+    auto order = op::Constant::create(element::i64, Shape{2}, {1, 0});
+    auto transpose = make_shared<op::v1::Transpose>(multiply, order);
+    auto indices = op::Constant::create(element::i64, Shape{4}, {0, 511, 3, -1});
+    auto axis = op::Constant::create(element::i64, Shape{}, {0});
+    auto gather = make_shared<op::v8::Gather>(transpose, indices, axis);
+    auto model = make_shared<ov::Model>(NodeVector{gather}, ParameterVector{});
+
+    run_constant_folding(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v8::Gather>(model), 0);
+    auto result = get_result_constant(model);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->get_output_shape(0), (Shape{4, rows}));
+
+    vector<float> expected;
+    for (size_t col : {0, 511, 3, 511}) {
+        for (size_t row = 0; row < rows; row++) {
+            expected.push_back(static_cast<float>((row * cols + col) % 16) * scales[row]);
+        }
+    }
+    ASSERT_EQ(result->cast_vector<float>(), expected);
+}
@@ -265,6 +265,25 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedMatcherPassAddedAfterRun) {
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+
+    auto f = get_function();
+    anchor.run_on_function(f);
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 1);
+
+    // the matchers index kept by GraphRewrite is updated with the new matcher
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    f = get_function();
+    anchor.run_on_function(f);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+
+    f = get_derived_function();
+    anchor.run_on_function(f);
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_function();
@@ -4,8 +4,12 @@
 
 #include "ir_deserializer.hpp"
 
+#include <cerrno>
+#include <cstdlib>
 #include <pugixml.hpp>
 #include <regex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ie_ngraph_utils.hpp"
 #include "meta_data.hpp"
@@ -422,21 +426,20 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         GenericLayerParams params;
     };
 
-    std::map<size_t /*layer-id*/, node_params> params;
+    std::unordered_map<size_t /*layer-id*/, node_params> params;
 
     std::vector<size_t /*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
 
     std::vector<size_t> order;
-    std::set<size_t> dfs_used_nodes;
-    std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
+    std::unordered_set<size_t> dfs_used_nodes;
+    std::unordered_map<size_t /*to-layer-id*/, std::vector<edge>> edges;
     // Read all layers and store their parameters in params map
     FOREACH_CHILD (node, root.child("layers"), "layer") {
         auto node_param = parseGenericParams(node);
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -447,6 +450,8 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             order.push_back(node_param.layerId);
             edges[node_param.layerId] = {};
         }
+        const auto layer_id = node_param.layerId;
+        params[layer_id] = {node, std::move(node_param)};
     }
 
     // Read all edges and store them for further usage
@@ -458,22 +463,32 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes, &dfs](const size_t id) {
-        if (dfs_used_nodes.count(id))
-            return;
-        dfs_used_nodes.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    // Run DFS starting from outputs to get nodes topological order. The DFS keeps its own stack of the layers
+    // and the next edge to visit, so the depth of the model is not limited by the stack of the thread.
+    std::vector<std::pair<size_t /*layer-id*/, size_t /*edge-index*/>> dfs_stack;
+    for (const auto output : outputs) {
+        if (!dfs_used_nodes.insert(output).second)
+            continue;
+        dfs_stack.emplace_back(output, 0);
+        while (!dfs_stack.empty()) {
+            auto& top = dfs_stack.back();
+            const auto& layer_edges = edges[top.first];
+            if (top.second < layer_edges.size()) {
+                const size_t from_layer_id = layer_edges[top.second++].fromLayerId;
+                if (dfs_used_nodes.insert(from_layer_id).second)
+                    dfs_stack.emplace_back(from_layer_id, 0);
+            } else {
+                order.push_back(top.first);
+                dfs_stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    id_to_node.reserve(order.size());
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
     //  Following topological order create nGraph operations
@@ -684,10 +699,13 @@ GenericLayerParams XmlDeserializer::parseGenericParams(const pugi::xml_node& nod
         port.portId = XMLParseUtils::GetUIntAttr(parentNode, "id");
 
         FOREACH_CHILD (node, parentNode, "dim") {
-            int64_t dim = 0;
             const pugi::char_t* dimVal = node.child_value();
-            std::stringstream ss(dimVal);
-            if (!(ss >> dim) || dim < -1) {
+            // strtoll skips the leading whitespaces and stops at the end of the number like the stream does, but
+            // doesn't construct a stream for every dimension of the model
+            char* dimEnd = nullptr;
+            errno = 0;
+            const int64_t dim = std::strtoll(dimVal, &dimEnd, 10);
+            if (dimEnd == dimVal || errno == ERANGE || dim < -1) {
                 IE_THROW() << "dimension (" << dimVal << ") in node " << node.name()
                            << " must be greater or equal to -1: at offset " << node.offset_debug();
             }
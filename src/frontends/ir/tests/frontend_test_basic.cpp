@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <sstream>
+
 #include "frontend_test.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
@@ -343,6 +346,172 @@ TEST_F(IRFrontendTests, model_with_weights_reading_from_disk) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+namespace {
+const std::string sharedWeightsModel = R"V0G0N(
+<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="i64" shape="4"/>
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="value1" type="Const" version="opset1">
+            <data element_type="i64" shape="4" offset="0" size="32" />
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="value2" type="Const" version="opset1">
+            <data element_type="i64" shape="4" offset="32" size="32" />
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="add1" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="add2" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="5" version="opset1">
+            <input>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="3" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="2" from-port="0" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+std::vector<unsigned char> sharedWeights() {
+    std::vector<unsigned char> buffer(64, 0);
+    int64_t* int64Buffer = reinterpret_cast<int64_t*>(buffer.data());
+    const int64_t values[] = {0, 3, 2, 1, 4, 5, 6, 7};
+    std::copy(std::begin(values), std::end(values), int64Buffer);
+    return buffer;
+}
+
+// the name of the file mapped at the address, empty if the address isn't in a file mapping
+std::string mappedFile(const void* address) {
+#ifdef __linux__
+    std::ifstream maps("/proc/self/maps");
+    const auto addr = reinterpret_cast<uintptr_t>(address);
+    std::string line;
+    while (std::getline(maps, line)) {
+        std::istringstream fields(line);
+        std::string range, perms, offset, device, inode, path;
+        fields >> range >> perms >> offset >> device >> inode >> path;
+        const auto dash = range.find('-');
+        const auto begin = std::stoull(range.substr(0, dash), nullptr, 16);
+        const auto end = std::stoull(range.substr(dash + 1), nullptr, 16);
+        if (addr >= begin && addr < end)
+            return path;
+    }
+#endif
+    return {};
+}
+
+std::vector<std::shared_ptr<ov::opset1::Constant>> getConstants(const std::shared_ptr<ov::Model>& model) {
+    std::vector<std::shared_ptr<ov::opset1::Constant>> constants;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::opset1::Constant>(op))
+            constants.push_back(constant);
+    }
+    std::sort(constants.begin(), constants.end(), [](const std::shared_ptr<ov::opset1::Constant>& a,
+                                                     const std::shared_ptr<ov::opset1::Constant>& b) {
+        return a->get_friendly_name() < b->get_friendly_name();
+    });
+    return constants;
+}
+}  // namespace
+
+TEST_F(IRFrontendTests, model_constants_share_weights) {
+    createTemporalModelFile(sharedWeightsModel, sharedWeights());
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    const auto constants = getConstants(model);
+    ASSERT_EQ(constants.size(), 2);
+    EXPECT_EQ(constants[0]->cast_vector<int64_t>(), (std::vector<int64_t>{0, 3, 2, 1}));
+    EXPECT_EQ(constants[1]->cast_vector<int64_t>(), (std::vector<int64_t>{4, 5, 6, 7}));
+    // the constants refer to the weights at their offsets instead of copying them
+    const auto data0 = static_cast<const char*>(constants[0]->get_data_ptr());
+    const auto data1 = static_cast<const char*>(constants[1]->get_data_ptr());
+    EXPECT_EQ(data1 - data0, 32);
+#ifdef __linux__
+    // the weights are the pages of the mapped weights file
+    EXPECT_NE(mappedFile(data0).find(binFileName), std::string::npos);
+    EXPECT_NE(mappedFile(data1).find(binFileName), std::string::npos);
+#endif
+
+    // the model keeps the weights alive
+    RemoveTemporalFiles();
+    EXPECT_EQ(constants[1]->cast_vector<int64_t>(), (std::vector<int64_t>{4, 5, 6, 7}));
+}
+
+TEST_F(IRFrontendTests, model_constants_share_read_weights_without_mmap) {
+    createTemporalModelFile(sharedWeightsModel, sharedWeights());
+
+    core.set_property(ov::enable_mmap(false));
+    EXPECT_FALSE(core.get_property(ov::enable_mmap.name()).as<bool>());
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    const auto constants = getConstants(model);
+    ASSERT_EQ(constants.size(), 2);
+    EXPECT_EQ(constants[0]->cast_vector<int64_t>(), (std::vector<int64_t>{0, 3, 2, 1}));
+    EXPECT_EQ(constants[1]->cast_vector<int64_t>(), (std::vector<int64_t>{4, 5, 6, 7}));
+    // the weights file is read to the memory once, the constants refer to it
+    const auto data0 = static_cast<const char*>(constants[0]->get_data_ptr());
+    const auto data1 = static_cast<const char*>(constants[1]->get_data_ptr());
+    EXPECT_EQ(data1 - data0, 32);
+    EXPECT_EQ(mappedFile(data0).find(binFileName), std::string::npos);
+}
+
 TEST_F(IRFrontendTests, model_without_weights_reading_from_disk) {
     std::string xmlModel = R"V0G0N(
 <?xml version="1.0" ?>
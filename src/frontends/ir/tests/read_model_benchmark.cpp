@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <sstream>
+
+#include "frontend_test.hpp"
+
+#ifndef _WIN32
+#    include <sys/resource.h>
+#endif
+
+namespace {
+// Generates IR v11 with the chain of the Add layers, every Add has its own Const input
+std::string generateChainModel(size_t numLayers) {
+    std::stringstream xml;
+    const auto port = [&](size_t id, bool output) {
+        xml << "<port id=\"" << id << "\"" << (output ? " precision=\"FP32\"" : "")
+            << "><dim>1</dim><dim>16</dim></port>";
+    };
+    xml << "<?xml version=\"1.0\" ?>\n<net name=\"Chain\" version=\"11\">\n<layers>\n";
+    xml << "<layer id=\"0\" name=\"input\" type=\"Parameter\" version=\"opset1\"><data element_type=\"f32\" "
+           "shape=\"1,16\"/><output>";
+    port(0, true);
+    xml << "</output></layer>\n";
+    for (size_t i = 0; i < numLayers; i++) {
+        xml << "<layer id=\"" << 2 * i + 1 << "\" name=\"const" << i
+            << "\" type=\"Const\" version=\"opset1\"><data element_type=\"f32\" shape=\"1,16\" offset=\"0\" "
+               "size=\"64\"/><output>";
+        port(0, true);
+        xml << "</output></layer>\n";
+        xml << "<layer id=\"" << 2 * i + 2 << "\" name=\"add" << i << "\" type=\"Add\" version=\"opset1\"><input>";
+        port(0, false);
+        port(1, false);
+        xml << "</input><output>";
+        port(2, true);
+        xml << "</output></layer>\n";
+    }
+    xml << "<layer id=\"" << 2 * numLayers + 1 << "\" name=\"output\" type=\"Result\" version=\"opset1\"><input>";
+    port(0, false);
+    xml << "</input></layer>\n</layers>\n<edges>\n";
+    for (size_t i = 0; i < numLayers; i++) {
+        xml << "<edge from-layer=\"" << (i == 0 ? 0 : 2 * i) << "\" from-port=\"" << (i == 0 ? 0 : 2)
+            << "\" to-layer=\"" << 2 * i + 2 << "\" to-port=\"0\"/>\n";
+        xml << "<edge from-layer=\"" << 2 * i + 1 << "\" from-port=\"0\" to-layer=\"" << 2 * i + 2
+            << "\" to-port=\"1\"/>\n";
+    }
+    xml << "<edge from-layer=\"" << 2 * numLayers << "\" from-port=\"2\" to-layer=\"" << 2 * numLayers + 1
+        << "\" to-port=\"0\"/>\n</edges>\n</net>\n";
+    return xml.str();
+}
+
+// Peak resident set size of the process in KB (0 if unknown)
+long peakRSS() {
+#ifndef _WIN32
+    struct rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_maxrss;
+#endif
+    return 0;
+}
+}  // namespace
+
+class IRFrontendBenchmark : public ::testing::Test, public IRFrontendTestsImpl {
+protected:
+    void TearDown() override {
+        RemoveTemporalFiles();
+    }
+};
+
+// Reports the time and the peak memory of read_model for the large synthetic IRs, the layers are chained so the
+// model is as deep as it is large
+TEST_F(IRFrontendBenchmark, DISABLED_ReadLargeModel) {
+    for (size_t numLayers : {10000, 100000, 500000}) {
+        const auto xmlModel = generateChainModel(numLayers);
+        createTemporalModelFile(xmlModel, std::vector<unsigned char>(64, 0));
+
+        const auto rssBefore = peakRSS();
+        const auto start = std::chrono::steady_clock::now();
+        std::shared_ptr<ov::Model> model;
+        ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+        const auto time =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        ASSERT_EQ(model->get_ops().size(), 2 * numLayers + 2);
+
+        std::cout << "layers: " << 2 * numLayers + 2 << ", xml: " << xmlModel.size() / 1024
+                  << " KB, read_model: " << time.count() << " ms, peak RSS growth: " << peakRSS() - rssBefore
+                  << " KB" << std::endl;
+        model.reset();
+        RemoveTemporalFiles();
+    }
+}
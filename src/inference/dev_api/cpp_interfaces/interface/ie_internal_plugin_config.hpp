@@ -92,6 +92,81 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Makes all the streams (and compiled models) with the same runtime cache capacity share the reentrant primitives
+ *        (e.g. oneDNN ones) via the single process-wide thread safe runtime parameters cache, the executors keeping
+ *        the state of the execution stay in the cache per stream. Supported values: YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_RUNTIME_CACHE);
+
+/**
+ * @brief Limits the approximate memory footprint (in bytes) of the records of the CPU runtime parameters cache per stream,
+ * the records which are cheap to rebuild per byte are evicted first. Zero (default) means no limit.
+ * The budget is not applied to the shared runtime cache.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_BUDGET);
+
+/**
+ * @brief Enables concurrent execution of independent graph branches inside a single CPU inference request
+ *        (static graphs only). Trades intermediate memory reuse for latency on wide models.
+ *        Supported values: YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief The number of bytes reserved for each buffer of the CPU variable states with dynamic shapes, so the states
+ *        growing on every inference (e.g. KV caches of the sequence models) are not reallocated until they reach the
+ *        reserve. The buffers growing beyond the reserve at least double their capacity. Zero (default) means no reserve.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_VARIABLE_STATE_RESERVE);
+
+/**
+ * @brief Makes the CPU compiled models share the packed (reordered) weights with the same content via the process-wide
+ *        content addressed store, so the variants of a model with mostly the same weights keep a single copy of them.
+ *        Supported values: YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_PACKED_WEIGHTS);
+
+/**
+ * @brief Places the packed weights of the CPU graphs on the NUMA node of their streams: every buffer of the weights is
+ *        allocated in a dedicated mapping with the node preferred for its pages. Has effect on the multi-socket machines
+ *        only. Supported values: YES (default)/NO
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_WEIGHTS_BINDING);
+
+/**
+ * @brief Places the intermediate tensors of the dynamic shape CPU graphs in a single memory arena. The offsets of the
+ *        tensors are planned for the actual shapes of every input shapes signature, so the memory footprint follows the
+ *        current shapes instead of the peak size of every tensor.
+ *        Supported values: YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_MEMORY_ARENA);
+
+/**
+ * @brief Allows the dynamic memory arena to shrink: the arena is reallocated when the planned size is less than half of
+ *        its capacity. Otherwise the arena only grows. Supported values: YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_MEMORY_ARENA_SHRINK);
+
+/**
+ * @brief Quantizes the constant tables of the CPU embedding bag operations row-wise: every row is stored as unsigned
+ *        integers with its own FP32 scale and bias, and is dequantized by the gathering kernel. The lossy option
+ *        reduces the table memory 4 (INT8) or 8 (INT4) times.
+ *        Supported values: NO (default)/INT8/INT4
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_EMBEDDING_TABLE_QUANTIZATION);
+DECLARE_CONFIG_VALUE(INT8);
+DECLARE_CONFIG_VALUE(INT4);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -99,6 +174,15 @@ DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
  */
 DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
 
+/**
+ * @brief Path to the cache file the network is imported from. The core passes it to the ImportNetwork of the plugins
+ *        which report it among ov::internal_supported_properties, so they can map the file into memory instead of
+ *        reading the stream.
+ *        The stream is still positioned at the beginning of the plugin data.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CACHED_BLOB_PATH);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
@@ -109,6 +193,13 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
  */
 DECLARE_CONFIG_KEY(ENABLE_HYPER_THREAD);
 
+/**
+ * @brief Makes the CPU Executor Streams pull the tasks from the per-stream lock-free queues with the work stealing
+ *        (instead of the single queue guarded by the mutex). Supported values: YES/NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_WORK_STEALING);
+
 /**
  * @brief Defines Snippets tokenization mode
  *      @param ENABLE - default pipeline
@@ -134,4 +225,35 @@ namespace ov {
  */
 static constexpr Property<std::vector<PropertyName>, PropertyMutability::RO> caching_properties{"CACHING_PROPERTIES"};
 
+/**
+ * @brief Read-only property to get a std::vector<PropertyName> of the internal properties accepted by the plugin,
+ * which aren't reported among ov::supported_properties
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr Property<std::vector<PropertyName>, PropertyMutability::RO> internal_supported_properties{
+    "INTERNAL_SUPPORTED_PROPERTIES"};
+
+/**
+ * @brief Read-only property to get the hits/misses/evictions counters of the CPU runtime parameters cache(s) used by the
+ * compiled model (the counters of the shared cache include the lookups of the other compiled models)
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the approximate memory footprint (in bytes) of the records of the CPU runtime parameters
+ * caches used by the compiled model (tracked only when the CPU_RUNTIME_CACHE_BUDGET is set)
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cpu_runtime_cache_bytes{"CPU_RUNTIME_CACHE_BYTES"};
+
+/**
+ * @brief Read-only property to get the bytes of the packed weights of the CPU compiled model resident on every NUMA node
+ * (the key is the NUMA node id), the weights shared by the streams are counted once
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_numa_weights_bytes{
+    "CPU_NUMA_WEIGHTS_BYTES"};
+
 }  // namespace ov
@@ -167,6 +167,32 @@ DECLARE_METRIC_KEY(NUMBER_OF_WAITING_INFER_REQUESTS, unsigned int);
  */
 DECLARE_METRIC_KEY(NUMBER_OF_EXEC_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Executable network metric with the auto-batching execution statistics.
+ *
+ * String value is "AUTO_BATCH_EXECUTION_STATS". Maps "batch_<N>" to the number of inferences executed with batch N
+ * (including the batch-1 fallback) and "timeouts" to the number of times the batch collection timed out
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_EXECUTION_STATS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Executable network metric to get the batch collection timeout (in ms) currently used by the auto-batching.
+ * Differs from the AUTO_BATCH_TIMEOUT when the AUTO_BATCH_LATENCY_TARGET is set (averaged over the internal batched
+ * requests)
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_CURRENT_TIMEOUT, float);
+
+/**
+ * @brief Executable network metric to get the average ratio of the requests collected by the auto-batching to the
+ * batch size (1.0 means the batch was always filled before the timeout)
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_FILL_RATIO, float);
+
+/**
+ * @brief Executable network metric to get the number of times the auto-batching collection timeout fired
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_TIMEOUTS_FIRED, uint64_t);
+
 /**
  * @brief Metric which defines the device architecture.
  */
@@ -294,6 +320,19 @@ DECLARE_CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG);
  * @brief Auto-batching configuration: string with timeout (in ms), e.g. "100"
  */
 DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+/**
+ * @brief Auto-batching configuration: YES/NO (default NO). When enabled, the networks with smaller power-of-two batch
+ * sizes (2, 4, 8, ...) are compiled in addition, so the requests collected by the moment of the timeout are executed
+ * with the largest fitting batch rather than one by one. Also accepts the comma-separated list of the batch sizes to
+ * compile, e.g. "2,6"
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES);
+/**
+ * @brief Auto-batching configuration: string with the p99 latency target (in ms), e.g. "50". When set to non-zero,
+ * the batch collection timeout is adjusted online (from the requests arrival rate and the observed latencies)
+ * to meet the target, and the AUTO_BATCH_TIMEOUT is used as the initial value only. Default is "0" (fixed timeout)
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET);
 
 /**
  * @brief Limit `#threads` that are used by Inference Engine for inference on the CPU.
@@ -593,6 +593,15 @@ static constexpr Property<std::tuple<unsigned int, unsigned int, unsigned int>,
  */
 static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FORCE_TBB_TERMINATE"};
 
+/**
+ * @brief Read-write property to set whether the weights file of the model is mapped to the memory on the model read
+ * value type: boolean
+ *   - True (default) the weights file is mapped, its pages are read once a consumer accesses the weights
+ *   - False the weights file is read to the memory, e.g. for the file systems where the mapping is undesirable
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
+
 /**
  * @brief Namespace with device properties
  */
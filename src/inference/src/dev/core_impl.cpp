@@ -644,6 +644,9 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::hint::allow_auto_batching.name()) {
         const auto flag = coreConfig.flag_allow_auto_batching;
         return decltype(ov::hint::allow_auto_batching)::value_type(flag);
+    } else if (name == ov::enable_mmap.name()) {
+        const auto flag = coreConfig.flag_enable_mmap;
+        return decltype(ov::enable_mmap)::value_type(flag);
     }
 
     OPENVINO_UNREACHABLE("Exception is thrown while trying to call get_property with unsupported property: '",
@@ -832,6 +835,11 @@ bool ov::CoreImpl::device_supports_property(const ov::Plugin& plugin, const std:
     return util::contains(plugin.get_property(ov::supported_properties), key);
 }
 
+bool ov::CoreImpl::device_supports_internal_property(const ov::Plugin& plugin, const std::string& key) const {
+    return device_supports_property(plugin, ov::internal_supported_properties.name()) &&
+           util::contains(plugin.get_property(ov::internal_supported_properties), key);
+}
+
 bool ov::CoreImpl::device_supports_import_export(const ov::Plugin& plugin) const {
     auto supportedMetricKeys = plugin.get_property(METRIC_KEY(SUPPORTED_METRICS), {}).as<std::vector<std::string>>();
     auto it = std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT));
@@ -907,8 +915,15 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(const CacheCon
                 throw HeaderException();
             }
 
-            execNetwork = context._impl ? plugin.import_model(networkStream, context, config)
-                                        : plugin.import_model(networkStream, config);
+            // the plugin may map the cache file instead of reading the weights from the stream
+            auto importConfig = config;
+            const auto blobPath = cacheContent.cacheManager->getCacheEntryPath(cacheContent.blobId);
+            if (!blobPath.empty() && device_supports_internal_property(plugin, CONFIG_KEY_INTERNAL(CACHED_BLOB_PATH))) {
+                importConfig[CONFIG_KEY_INTERNAL(CACHED_BLOB_PATH)] = blobPath;
+            }
+
+            execNetwork = context._impl ? plugin.import_model(networkStream, context, importConfig)
+                                        : plugin.import_model(networkStream, importConfig);
             networkIsImported = true;
             execNetwork->loaded_from_cache();
         });
@@ -1008,6 +1023,13 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
         flag_allow_auto_batching = flag;
         config.erase(it);
     }
+
+    it = config.find(ov::enable_mmap.name());
+    if (it != config.end()) {
+        auto flag = it->second.as<bool>();
+        flag_enable_mmap = flag;
+        config.erase(it);
+    }
 }
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
@@ -97,6 +97,8 @@ private:
 
         bool flag_allow_auto_batching = true;
 
+        bool flag_enable_mmap = true;
+
         void set_and_update(ov::AnyMap& config);
 
         void set_cache_dir_for_device(const std::string& dir, const std::string& name);
@@ -189,6 +191,8 @@ private:
 
     bool device_supports_property(const ov::Plugin& plugin, const std::string& key) const;
 
+    bool device_supports_internal_property(const ov::Plugin& plugin, const std::string& key) const;
+
     bool device_supports_cache_dir(const ov::Plugin& plugin) const;
 
     ov::SoPtr<ov::ICompiledModel> compile_model(ov::Plugin& plugin,
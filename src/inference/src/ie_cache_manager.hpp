@@ -70,6 +70,18 @@ public:
      * @param id Id of cache (hash of the network)
      */
     virtual void removeCacheEntry(const std::string& id) = 0;
+
+    /**
+     * @brief Returns the path of the file the cache entry is stored in
+     *
+     * Plugins may map the file into memory instead of reading the stream (see CACHED_BLOB_PATH)
+     *
+     * @param id Id of cache (hash of the network)
+     * @return The file path or an empty string if the entry is not stored in a file
+     */
+    virtual std::string getCacheEntryPath(const std::string& id) const {
+        return {};
+    }
 };
 
 /**
@@ -117,6 +129,10 @@ private:
         if (FileUtils::fileExist(blobFileName))
             std::remove(blobFileName.c_str());
     }
+
+    std::string getCacheEntryPath(const std::string& id) const override {
+        return getBlobFile(id);
+    }
 };
 
 }  // namespace InferenceEngine
@@ -8,6 +8,7 @@
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -26,7 +27,96 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer/multi-consumer lock-free queue (by D. Vyukov).
+ *        The producers and consumers claim the cells by CAS on the positions, the sequence number of the cell
+ *        tells whether the cell is ready to be written (by the producer) or read (by the consumer).
+ */
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    explicit LockFreeBoundedQueue(std::size_t capacity) : _cells(capacity), _mask(capacity - 1) {
+        assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // the value is moved from only when the push succeeded
+    bool try_push(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_value = {};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // approximate, as the concurrent push/pop may be in flight
+    bool empty() const {
+        return _dequeuePos.load(std::memory_order_acquire) >= _enqueuePos.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> _sequence{0};
+        T _value;
+    };
+    std::vector<Cell> _cells;
+    const std::size_t _mask;
+    // separate cache lines, so the producers and consumers do not contend
+    alignas(64) std::atomic<std::size_t> _enqueuePos{0};
+    alignas(64) std::atomic<std::size_t> _dequeuePos{0};
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    // the per-stream task queues used in the work stealing mode
+    struct WorkerQueue {
+        static constexpr std::size_t capacity = 1024;
+        std::atomic<int> _numaNodeId{-1};  // set by the worker thread, once its stream is created
+        LockFreeBoundedQueue<Task> _queue{capacity};
+    };
+    // number of attempts to get a task (yielding in between) before the idle worker parks on the condition variable
+    static constexpr int spinCount = 64;
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -275,9 +365,18 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._workStealing) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _workerQueues.emplace_back(new WorkerQueue);
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                if (_config._workStealing) {
+                    WorkStealingLoop(streamId);
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -306,6 +405,97 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    // pushes the task to the per-stream queues in the round-robin fashion (the idle workers steal the tasks anyway),
+    // the shared queue is used only when all the per-stream queues are full
+    void EnqueueWorkStealing(Task task) {
+        const auto numQueues = _workerQueues.size();
+        const auto first = _nextWorkerQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (std::size_t i = 0; i < numQueues && !pushed; ++i) {
+            pushed = _workerQueues[(first + i) % numQueues]->_queue.try_push(task);
+        }
+        if (!pushed) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+            ++_numOverflowTasks;
+        }
+        // pairs with the increment of the parked workers counter in the WorkStealingLoop,
+        // so either the parking worker sees the task or the task producer sees the parking worker
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_numParkedWorkers.load(std::memory_order_relaxed) > 0) {
+            // the parking worker checks the queues under the lock, so the notification can not be lost
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool HasTasks() const {
+        if (_numOverflowTasks.load() > 0) {
+            return true;
+        }
+        for (const auto& workerQueue : _workerQueues) {
+            if (!workerQueue->_queue.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the own queue first, then stealing from the streams on the same NUMA node, then from the rest of the streams
+    bool TryPopTask(Task& task, int workerId, int numaNodeId) {
+        const auto numQueues = static_cast<int>(_workerQueues.size());
+        if (_workerQueues[workerId]->_queue.try_pop(task)) {
+            return true;
+        }
+        for (bool sameNode : {true, false}) {
+            for (int i = 1; i < numQueues; ++i) {
+                auto& victim = *_workerQueues[(workerId + i) % numQueues];
+                if (sameNode == (victim._numaNodeId.load(std::memory_order_relaxed) == numaNodeId) &&
+                    victim._queue.try_pop(task)) {
+                    return true;
+                }
+            }
+        }
+        if (_numOverflowTasks.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                --_numOverflowTasks;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkStealingLoop(int workerId) {
+        auto& stream = *(_streams.local());
+        _workerQueues[workerId]->_numaNodeId = stream._numaNodeId;
+        for (bool stopped = false;;) {
+            Task task;
+            bool found = false;
+            for (int spin = 0; spin < spinCount && !(found = TryPopTask(task, workerId, stream._numaNodeId));
+                 ++spin) {
+                std::this_thread::yield();
+            }
+            if (found) {
+                Execute(task, stream);
+                continue;
+            }
+            if (stopped) {
+                break;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            ++_numParkedWorkers;
+            _queueCondVar.wait(lock, [&] {
+                return HasTasks() || (stopped = _isStopped);
+            });
+            --_numParkedWorkers;
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -344,6 +534,10 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<std::size_t> _nextWorkerQueue{0};
+    std::atomic<int> _numParkedWorkers{0};
+    std::atomic<std::size_t> _numOverflowTasks{0};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -390,6 +584,8 @@ void CPUStreamsExecutor::Execute(Task task) {
 void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
+    } else if (_impl->_config._workStealing) {
+        _impl->EnqueueWorkStealing(std::move(task));
     } else {
         _impl->Enqueue(std::move(task));
     }
@@ -34,6 +34,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
         CONFIG_KEY_INTERNAL(THREADS_PER_STREAM_SMALL),
         CONFIG_KEY_INTERNAL(SMALL_CORE_OFFSET),
         CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING),
         ov::num_streams.name(),
         ov::inference_num_threads.name(),
         ov::affinity.name(),
@@ -290,6 +291,15 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
         } else {
             OPENVINO_UNREACHABLE("Unsupported enable hyper thread type");
         }
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _workStealing = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _workStealing = false;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)
+                       << ". Expected only YES/NO";
+        }
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -340,6 +350,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) const {
         return {std::to_string(_small_core_offset)};
     } else if (key == CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD)) {
         return {_enable_hyper_thread ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)) {
+        return {_workStealing ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -5,8 +5,12 @@
 #include <gtest/gtest.h>
 #include <ie_system_conf.h>
 
+#include <chrono>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <future>
 #include <ie_parallel.hpp>
+#include <ie_plugin_config.hpp>
+#include <iostream>
 #include <thread>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
@@ -216,6 +220,53 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+TEST_F(StreamsExecutorConfigTest, canSetWorkStealing) {
+    IStreamsExecutor::Config config;
+    ASSERT_FALSE(config._workStealing);
+    config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING), CONFIG_VALUE(YES));
+    ASSERT_TRUE(config._workStealing);
+    ASSERT_EQ(CONFIG_VALUE(YES), config.GetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)).as<std::string>());
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING), "MAYBE"), Exception);
+}
+
+// microbenchmark: many short tasks submitted from several threads to many streams,
+// compares the tasks/sec of the single shared queue vs the per-stream queues with the work stealing
+// (disabled by default, run with --gtest_also_run_disabled_tests)
+TEST(StreamsExecutorBenchmark, DISABLED_TasksPerSecond) {
+    constexpr int numProducers = 4;
+    constexpr int numTasksPerProducer = 250000;
+    const auto streams = getNumberOfLogicalCPUCores();
+    for (bool workStealing : {false, true}) {
+        IStreamsExecutor::Config config{"BenchmarkCPUStreamsExecutor", streams, 1};
+        config._workStealing = workStealing;
+        std::atomic<int> done{0};
+        std::promise<void> allDone;
+        auto start = std::chrono::steady_clock::now();
+        {
+            CPUStreamsExecutor executor{config};
+            std::vector<std::thread> producers;
+            for (int p = 0; p < numProducers; p++) {
+                producers.emplace_back([&] {
+                    for (int t = 0; t < numTasksPerProducer; t++) {
+                        executor.run([&] {
+                            if (++done == numProducers * numTasksPerProducer)
+                                allDone.set_value();
+                        });
+                    }
+                });
+            }
+            for (auto& producer : producers)
+                producer.join();
+            allDone.get_future().wait();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        ASSERT_EQ(numProducers * numTasksPerProducer, done);
+        std::cout << (workStealing ? "work stealing queues: " : "single shared queue:  ")
+                  << static_cast<size_t>(done / elapsed.count()) << " tasks/sec (" << streams << " streams)"
+                  << std::endl;
+    }
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -244,6 +295,16 @@ static auto Executors = ::testing::Values(
                                      threads / streams,
                                      IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams,
+                                        threads / streams,
+                                        IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -277,6 +338,16 @@ static auto AsyncExecutors = ::testing::Values(
                                      streams,
                                      threads / streams,
                                      IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams,
+                                        threads / streams,
+                                        IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
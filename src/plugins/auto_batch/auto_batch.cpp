@@ -5,9 +5,13 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <set>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -29,6 +33,8 @@ using namespace InferenceEngine;
 
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES),
+                                                 CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET),
                                                  CONFIG_KEY(CACHE_DIR)};
 
 template <Precision::ePrecision precision>
@@ -36,7 +42,8 @@ Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
                                                     std::string name,
                                                     const std::set<std::string>& batched_names,
                                                     size_t batch_id,
-                                                    size_t batch_num) {
+                                                    size_t batch_num,
+                                                    size_t num_slots) {
     typedef typename PrecisionTrait<precision>::value_type TYPE;
     typedef typename std::add_pointer<TYPE>::type TYPEPTR;
     auto ptr = batched_blob->buffer().as<TYPEPTR>();
@@ -44,16 +51,118 @@ Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
     SizeVector dims = batched_blob->getTensorDesc().getDims();
     // for performance reason (copy avoidance) current impl of the auto-batching supports only batching by 0th dim
     if (batched_names.count(name)) {
-        dims[0] = 1;
+        dims[0] = num_slots;
         return make_shared_blob<TYPE>({precision, dims, batched_blob->getTensorDesc().getLayout()},
                                       ptr + sizePerBatch * batch_id,
-                                      sizePerBatch);
+                                      sizePerBatch * num_slots);
     } else {
         // same blob for all requests (e.g. constants)
         return make_shared_blob<TYPE>({precision, dims, batched_blob->getTensorDesc().getLayout()}, ptr);
     }
 }
 
+// creates the blob sharing the memory of the [batch_id, batch_id + num_slots) part of the batched blob
+Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
+                                                    Precision precision,
+                                                    std::string name,
+                                                    const std::set<std::string>& batched_names,
+                                                    size_t batch_id,
+                                                    size_t batch_num,
+                                                    size_t num_slots = 1) {
+#define CASE(prc)                                                                                            \
+    case Precision::prc:                                                                                     \
+        return create_shared_blob_on_top_of_batched_blob<Precision::prc>(batched_blob,                      \
+                                                                         name,                              \
+                                                                         batched_names,                     \
+                                                                         batch_id,                          \
+                                                                         batch_num,                         \
+                                                                         num_slots);
+    switch (precision) {
+        CASE(FP32)
+        CASE(I32)
+        CASE(I8)
+        CASE(I16)
+        CASE(U16)
+        CASE(U32)
+        CASE(FP64)
+        CASE(FP16)
+        CASE(BF16)
+        CASE(U64)
+        CASE(I64)
+        CASE(U8)
+        CASE(BOOL)
+    default:
+        IE_THROW(NotImplemented) << "Unsupported precision " << precision;
+    }
+#undef CASE
+}
+
+// ------------------------------AdaptiveTimeout----------------------------
+constexpr size_t AdaptiveTimeout::kWindow;
+constexpr int64_t AdaptiveTimeout::kMinTimeoutUs;
+
+AdaptiveTimeout::AdaptiveTimeout(int batchSize, std::chrono::microseconds initial)
+    : _batchSize(batchSize),
+      _timeoutUs(initial.count()) {
+    _executionUs.reserve(kWindow);
+    _endToEndUs.reserve(kWindow);
+}
+
+void AdaptiveTimeout::RecordArrival(Clock::time_point arrival) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_hasArrival) {
+        const double delta = std::chrono::duration<double, std::micro>(arrival - _lastArrival).count();
+        _interArrivalUs = _interArrivalUs < 0 ? delta : 0.9 * _interArrivalUs + 0.1 * delta;
+    }
+    _lastArrival = arrival;
+    _hasArrival = true;
+}
+
+void AdaptiveTimeout::RecordExecution(Clock::duration execution, Clock::duration endToEnd) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const double executionUs = std::chrono::duration<double, std::micro>(execution).count();
+    const double endToEndUs = std::chrono::duration<double, std::micro>(endToEnd).count();
+    if (_executionUs.size() < kWindow) {
+        _executionUs.push_back(executionUs);
+        _endToEndUs.push_back(endToEndUs);
+    } else {
+        _executionUs[_nextSample] = executionUs;
+        _endToEndUs[_nextSample] = endToEndUs;
+    }
+    _nextSample = (_nextSample + 1) % kWindow;
+    _numNewSamples++;
+}
+
+double AdaptiveTimeout::Percentile(std::vector<double> samples, double p) {
+    const auto nth = samples.begin() + static_cast<ptrdiff_t>(p * (samples.size() - 1));
+    std::nth_element(samples.begin(), nth, samples.end());
+    return *nth;
+}
+
+std::chrono::microseconds AdaptiveTimeout::Update(std::chrono::microseconds target) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // nothing new was executed since the last update, so the feedback is the same
+    if (!_numNewSamples)
+        return Get();
+    _numNewSamples = 0;
+    const double targetUs = static_cast<double>(target.count());
+    // the feedback on the observed latency compensates for the queueing delays that the estimate doesn't cover
+    const double endToEndP99 = Percentile(_endToEndUs, 0.99);
+    if (endToEndP99 > targetUs)
+        _correction = std::max(0.1, _correction * 0.9);
+    else if (endToEndP99 < 0.8 * targetUs)
+        _correction = std::min(1.0, _correction * 1.05);
+    // a request waits at most the timeout and then is executed (either batched or not)
+    double timeoutUs = std::max(0.0, (targetUs - Percentile(_executionUs, 0.99)) * _correction);
+    // no reason to wait much longer than it takes to fill the batch at the current arrival rate,
+    // this releases the requests sooner when the traffic stops
+    if (_interArrivalUs > 0)
+        timeoutUs = std::min(timeoutUs, 2 * (_batchSize - 1) * _interArrivalUs);
+    // the worker shouldn't spin when the execution alone doesn't fit the target
+    _timeoutUs = std::max(kMinTimeoutUs, static_cast<int64_t>(timeoutUs));
+    return Get();
+}
+
 // ------------------------------AutoBatchInferRequest----------------------------
 AutoBatchInferRequest::AutoBatchInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                              const std::vector<std::shared_ptr<const ov::Node>>& outputs,
@@ -65,7 +174,9 @@ AutoBatchInferRequest::AutoBatchInferRequest(const std::vector<std::shared_ptr<c
     : IInferRequestInternal(inputs, outputs),
       _myBatchedRequestWrapper(workerRequest),
       _batchId(batch_id),
-      _batchSize(num_batch) {
+      _batchSize(num_batch),
+      _batchedInputs(batchedInputs),
+      _batchedOutputs(batchedOutputs) {
     ShareBlobsWithBatchRequest(batchedInputs, batchedOutputs);
 }
 
@@ -79,7 +190,9 @@ AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap& networkInputs,
     : IInferRequestInternal(networkInputs, networkOutputs),
       _myBatchedRequestWrapper(workerRequest),
       _batchId(batch_id),
-      _batchSize(num_batch) {
+      _batchSize(num_batch),
+      _batchedInputs(batchedInputs),
+      _batchedOutputs(batchedOutputs) {
     ShareBlobsWithBatchRequest(batchedInputs, batchedOutputs);
 }
 
@@ -87,233 +200,61 @@ void AutoBatchInferRequest::ShareBlobsWithBatchRequest(const std::set<std::strin
                                                        const std::set<std::string>& batchedOutputs) {
     // Allocate all input blobs
     for (const auto& it : _networkInputs) {
-        auto blob = _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first);
-        Blob::Ptr res;
-        switch (it.second->getTensorDesc().getPrecision()) {
-        case InferenceEngine::Precision::FP32:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::FP32>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::I32:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::I32>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::I8:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::I8>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::I16:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::I16>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::U16:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::U16>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::U32:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::U32>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::FP64:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::FP64>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::FP16:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::FP16>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::BF16:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::BF16>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::U64:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::U64>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::I64:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::I64>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::U8:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::U8>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::BOOL:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::BOOL>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedInputs,
-                _batchId,
-                _batchSize);
-            break;
-        default:
-            IE_THROW() << "Unsupported input precision " << it.second->getTensorDesc().getPrecision();
-        }
-        _inputs[it.first] = res;
+        _inputs[it.first] =
+            create_shared_blob_on_top_of_batched_blob(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
+                                                      it.second->getTensorDesc().getPrecision(),
+                                                      it.first,
+                                                      batchedInputs,
+                                                      _batchId,
+                                                      _batchSize);
     }
     // Allocate all output blobs
     for (const auto& it : _networkOutputs) {
-        auto blob = _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first);
-        Blob::Ptr res;
-        switch (it.second->getTensorDesc().getPrecision()) {
-        case InferenceEngine::Precision::FP32:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::FP32>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::I32:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::I32>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::I8:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::I8>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::I16:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::I16>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::U16:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::U16>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::U32:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::U32>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::FP64:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::FP64>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::FP16:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::FP16>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::BF16:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::BF16>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::U64:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::U64>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::I64:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::I64>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::U8:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::U8>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        case InferenceEngine::Precision::BOOL:
-            res = create_shared_blob_on_top_of_batched_blob<InferenceEngine::Precision::BOOL>(
-                _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
-                it.first,
-                batchedOutputs,
-                _batchId,
-                _batchSize);
-            break;
-        default:
-            IE_THROW(NotImplemented) << "Unsupported input precision " << it.second->getTensorDesc().getPrecision();
-        }
-        _outputs[it.first] = res;
+        _outputs[it.first] =
+            create_shared_blob_on_top_of_batched_blob(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first),
+                                                      it.second->getTensorDesc().getPrecision(),
+                                                      it.first,
+                                                      batchedOutputs,
+                                                      _batchId,
+                                                      _batchSize);
+    }
+}
+bool AutoBatchInferRequest::AreBlobsSharedWithBatchRequest() {
+    auto& batchedRequest = _myBatchedRequestWrapper._inferRequestBatched;
+    auto isShared = [this](const Blob::Ptr& blob, const Blob::Ptr& batchedBlob) {
+        const auto offset = blob->byteSize() != batchedBlob->byteSize() ? _batchId * blob->byteSize() : 0;
+        return blob->cbuffer().as<const char*>() == batchedBlob->cbuffer().as<const char*>() + offset;
+    };
+    for (const auto& it : _networkInputs) {
+        if (!isShared(GetBlob(it.first), batchedRequest->GetBlob(it.first)))
+            return false;
+    }
+    for (const auto& it : _networkOutputs) {
+        if (!isShared(GetBlob(it.first), batchedRequest->GetBlob(it.first)))
+            return false;
     }
+    return true;
+}
+
+void AutoBatchInferRequest::ShareBatchRequestSlotsWith(SoIInferRequestInternal& req, size_t numSlots) {
+    auto& batchedRequest = _myBatchedRequestWrapper._inferRequestBatched;
+    auto share = [&](const std::string& name, Precision precision, const std::set<std::string>& batchedNames) {
+        auto blob = create_shared_blob_on_top_of_batched_blob(batchedRequest->GetBlob(name),
+                                                              precision,
+                                                              name,
+                                                              batchedNames,
+                                                              _batchId,
+                                                              _batchSize,
+                                                              numSlots);
+        if (req->GetBlob(name)->cbuffer().as<const void*>() != blob->cbuffer().as<const void*>())
+            req->SetBlob(name, blob);
+    };
+    for (const auto& it : _networkInputs)
+        share(it.first, it.second->getTensorDesc().getPrecision(), _batchedInputs);
+    for (const auto& it : _networkOutputs)
+        share(it.first, it.second->getTensorDesc().getPrecision(), _batchedOutputs);
 }
+
 void AutoBatchInferRequest::SetBlobsToAnotherRequest(SoIInferRequestInternal& req) {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
@@ -332,16 +273,22 @@ void AutoBatchInferRequest::SetBlobsToAnotherRequest(SoIInferRequestInternal& re
 }
 
 void AutoBatchInferRequest::CopyInputsIfNeeded() {
+    CopyInputsIfNeeded(_myBatchedRequestWrapper._inferRequestBatched, _batchId, _batchSize);
+}
+
+void AutoBatchInferRequest::CopyInputsIfNeeded(SoIInferRequestInternal& req, size_t batchId, size_t batchSize) {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, batchId, batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -349,13 +296,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -364,10 +311,14 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
 }
 
 void AutoBatchInferRequest::CopyOutputsIfNeeded() {
+    CopyOutputsIfNeeded(_myBatchedRequestWrapper._inferRequestBatched, _batchId, _batchSize);
+}
+
+void AutoBatchInferRequest::CopyOutputsIfNeeded(SoIInferRequestInternal& req, size_t batchId, size_t batchSize) {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, batchId, batchSize);
     }
 }
 
@@ -383,6 +334,8 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
         explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
             auto& workerInferRequest = _this->_inferRequest->_myBatchedRequestWrapper;
+            _this->_inferRequest->_arrivalTime = AdaptiveTimeout::Clock::now();
+            workerInferRequest._adaptiveTimeout->RecordArrival(_this->_inferRequest->_arrivalTime);
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
@@ -413,6 +366,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_partialBatchedRequest->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -432,11 +387,13 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
-    const std::set<std::string>& batchedOutputs)
+    const std::set<std::string>& batchedOutputs,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksPartialBatch)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networksPartialBatch{networksPartialBatch},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -445,6 +402,14 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
     _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto latency_target = config.find(CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET));
+    if (latency_target != config.end())
+        _latencyTarget = ParseTimeoutValue(latency_target->second.as<std::string>());
+    _executionStats["timeouts"] = 0;
+    _executionStats["batch_1"] = 0;
+    _executionStats["batch_" + std::to_string(_device.batchForDevice)] = 0;
+    for (const auto& net : _networksPartialBatch)
+        _executionStats["batch_" + std::to_string(net.first)] = 0;
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -462,6 +427,13 @@ unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s)
     return val;
 }
 
+std::chrono::microseconds AutoBatchExecutableNetwork::GetTimeout(WorkerInferRequest& workerRequest) {
+    const int target = _latencyTarget;
+    if (!target)
+        return std::chrono::milliseconds(_timeOut);
+    return workerRequest._adaptiveTimeout->Update(std::chrono::milliseconds(target));
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
     return _networkWithoutBatch->GetContext();
 }
@@ -502,13 +474,31 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         _workerRequests.push_back(std::make_shared<WorkerInferRequest>());
         auto workerRequestPtr = _workerRequests.back().get();
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
+        for (const auto& net : _networksPartialBatch)
+            workerRequestPtr->_inferRequestsPartialBatched[net.first] = {net.second->CreateInferRequest(),
+                                                                         net.second._so};
+        for (const auto& req : workerRequestPtr->_inferRequestsPartialBatched) {
+            auto& blobs = workerRequestPtr->_partialBatchedBlobs[req.first];
+            for (const auto& it : _networkInputs)
+                blobs[it.first] = req.second->GetBlob(it.first);
+            for (const auto& it : _networkOutputs)
+                blobs[it.first] = req.second->GetBlob(it.first);
+        }
         workerRequestPtr->_batchSize = _device.batchForDevice;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
+        workerRequestPtr->_arrivalTimes.resize(workerRequestPtr->_batchSize);
+        workerRequestPtr->_adaptiveTimeout.reset(
+            new AdaptiveTimeout(workerRequestPtr->_batchSize, std::chrono::milliseconds(_timeOut)));
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
+                const auto now = AdaptiveTimeout::Clock::now();
+                for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
+                    workerRequestPtr->_adaptiveTimeout->RecordExecution(now - workerRequestPtr->_startTime,
+                                                                        now - workerRequestPtr->_arrivalTimes[c]);
+                }
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
                     workerRequestPtr->_completionTasks[c]();
@@ -522,7 +512,7 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(lock, GetTimeout(*workerRequestPtr));
                 }
                 if (_terminate) {
                     break;
@@ -535,35 +525,18 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completionTasks[n] = std::move(t.second);
+                            workerRequestPtr->_arrivalTimes[n] = t.first->_inferRequest->_arrivalTime;
                             t.first->_inferRequest->CopyInputsIfNeeded();
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        UpdateExecutionStats(sz, false);
+                        UpdateCollectionStats(sz);
+                        workerRequestPtr->_startTime = AdaptiveTimeout::Clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->_inferRequest->_exceptionPtr = p;
-                                    t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
-                                });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
-                        }
-                        all_completed_future.get();
-                        // now when all the tasks for this batch are completed, start waiting for the timeout again
+                        // timeout to collect the batch is over, have to execute the collected requests
+                        ExecutePartialBatch(*workerRequestPtr, sz);
                     }
                 }
             }
@@ -572,6 +545,114 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
     return {*_workerRequests.back(), static_cast<int>(batch_id)};
 }
 
+void AutoBatchExecutableNetwork::ExecutePartialBatch(WorkerInferRequest& workerRequest, int numRequests) {
+    UpdateExecutionStats(0, true);
+    UpdateCollectionStats(numRequests);
+    const auto start = AdaptiveTimeout::Clock::now();
+    auto& adaptiveTimeout = *workerRequest._adaptiveTimeout;
+    std::atomic<int> arrived = {0};
+    std::promise<void> all_completed;
+    auto all_completed_future = all_completed.get_future();
+    auto onCompleted = [numRequests, &arrived, &all_completed](int completed) {
+        if (numRequests == (arrived += completed))
+            all_completed.set_value();
+    };
+    // popping all tasks collected by the moment of the time-out, the largest fitting smaller batch networks
+    // are used first, the remaining tasks are executed with batch1. Every batched request is taken at most once, as
+    // it is busy until the completion: the ladder misses the batch sizes failed to compile, so the same smaller
+    // batch may fit the remaining tasks again
+    int remaining = numRequests;
+    auto& ladder = workerRequest._inferRequestsPartialBatched;
+    for (auto partial = ladder.rbegin(); partial != ladder.rend() && remaining; ++partial) {
+        const int batch = partial->first;
+        if (batch > remaining)
+            continue;
+        auto& batchedRequest = partial->second;
+        std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> tasks(batch);
+        for (int n = 0; n < batch; n++)
+            IE_ASSERT(workerRequest._tasks.try_pop(tasks[n]));
+        // when the requests occupy the consecutive slots of the batched request and the user works with the
+        // blobs shared with these slots, the smaller batch request executes directly on top of these slots
+        std::sort(tasks.begin(), tasks.end(), [](const decltype(tasks)::value_type& a,
+                                                 const decltype(tasks)::value_type& b) {
+            return a.first->_inferRequest->GetBatchId() < b.first->_inferRequest->GetBatchId();
+        });
+        bool shareSlots = true;
+        for (int n = 0; n < batch && shareSlots; n++) {
+            auto& request = tasks[n].first->_inferRequest;
+            shareSlots = request->GetBatchId() == tasks[0].first->_inferRequest->GetBatchId() + n &&
+                         request->AreBlobsSharedWithBatchRequest();
+        }
+        if (shareSlots) {
+            tasks[0].first->_inferRequest->ShareBatchRequestSlotsWith(batchedRequest, batch);
+        } else {
+            for (const auto& blob : workerRequest._partialBatchedBlobs[batch]) {
+                if (batchedRequest->GetBlob(blob.first) != blob.second)
+                    batchedRequest->SetBlob(blob.first, blob.second);
+            }
+        }
+        for (int n = 0; n < batch; n++) {
+            auto& request = tasks[n].first->_inferRequest;
+            // no-op for the shared slots
+            request->CopyInputsIfNeeded(batchedRequest, n, batch);
+            request->_partialBatchedRequest = batchedRequest;
+            request->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+        }
+        // the callback refers to the request via the reference to avoid the request owning itself
+        batchedRequest->SetCallback([tasks, batch, &batchedRequest, start, &adaptiveTimeout, onCompleted](
+                                        std::exception_ptr p) {
+            const auto now = AdaptiveTimeout::Clock::now();
+            for (int n = 0; n < batch; n++) {
+                auto& request = tasks[n].first->_inferRequest;
+                adaptiveTimeout.RecordExecution(now - start, now - request->_arrivalTime);
+                if (p)
+                    request->_exceptionPtr = p;
+                else
+                    request->CopyOutputsIfNeeded(batchedRequest, n, batch);
+                tasks[n].second();
+            }
+            onCompleted(batch);
+        });
+        UpdateExecutionStats(batch, false);
+        batchedRequest->StartAsync();
+        remaining -= batch;
+    }
+    std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+    for (; remaining; remaining--) {
+        IE_ASSERT(workerRequest._tasks.try_pop(t));
+        t.first->_inferRequestWithoutBatch->SetCallback([t, start, &adaptiveTimeout, onCompleted](
+                                                            std::exception_ptr p) {
+            const auto now = AdaptiveTimeout::Clock::now();
+            adaptiveTimeout.RecordExecution(now - start, now - t.first->_inferRequest->_arrivalTime);
+            if (p)
+                t.first->_inferRequest->_exceptionPtr = p;
+            t.second();
+            onCompleted(1);
+        });
+        t.first->_inferRequest->_wasBatchedRequestUsed =
+            AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+        t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+        UpdateExecutionStats(1, false);
+        t.first->_inferRequestWithoutBatch->StartAsync();
+    }
+    all_completed_future.get();
+    // now when all the tasks for this batch are completed, start waiting for the timeout again
+}
+
+void AutoBatchExecutableNetwork::UpdateCollectionStats(int numRequests) {
+    std::lock_guard<std::mutex> lock(_executionStatsMutex);
+    _numCollections++;
+    _numCollectedRequests += numRequests;
+}
+
+void AutoBatchExecutableNetwork::UpdateExecutionStats(int batch, bool timeout) {
+    std::lock_guard<std::mutex> lock(_executionStatsMutex);
+    if (timeout)
+        _executionStats["timeouts"]++;
+    else
+        _executionStats["batch_" + std::to_string(batch)]++;
+}
+
 InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
     if (!_network) {
         auto res = _networkWithoutBatch->CreateInferRequest();
@@ -599,13 +680,17 @@ std::shared_ptr<ngraph::Function> AutoBatchExecutableNetwork::GetExecGraphInfo()
 }
 
 void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) {
+    for (const auto& kvp : config) {
+        if (kvp.first != CONFIG_KEY(AUTO_BATCH_TIMEOUT) && kvp.first != CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET))
+            IE_THROW() << "The only configs that can be changed on the fly for the AutoBatching are the "
+                       << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " and " << CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET);
+    }
     auto timeout = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
-    if (timeout == config.end() || config.size() > 1) {
-        IE_THROW() << "The only config that can be changed on the fly for the AutoBatching the is the "
-                   << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
-    } else {
+    if (timeout != config.end())
         _timeOut = ParseTimeoutValue(timeout->second.as<std::string>());
-    }
+    auto latency_target = config.find(CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET));
+    if (latency_target != config.end())
+        _latencyTarget = ParseTimeoutValue(latency_target->second.as<std::string>());
 }
 
 InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string& name) const {
@@ -646,10 +731,39 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
                               METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+                              METRIC_KEY(AUTO_BATCH_EXECUTION_STATS),
+                              METRIC_KEY(AUTO_BATCH_CURRENT_TIMEOUT),
+                              METRIC_KEY(AUTO_BATCH_FILL_RATIO),
+                              METRIC_KEY(AUTO_BATCH_TIMEOUTS_FIRED),
                               ov::execution_devices.name()});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
-                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
+                             {CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                              CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)});  // only timeouts can be changed on the fly
+    } else if (name == METRIC_KEY(AUTO_BATCH_EXECUTION_STATS)) {
+        std::lock_guard<std::mutex> lock(_executionStatsMutex);
+        IE_SET_METRIC_RETURN(AUTO_BATCH_EXECUTION_STATS, _executionStats);
+    } else if (name == METRIC_KEY(AUTO_BATCH_CURRENT_TIMEOUT)) {
+        float timeout = static_cast<float>(_timeOut);
+        if (_latencyTarget) {
+            std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+            if (!_workerRequests.empty()) {
+                timeout = 0.f;
+                for (const auto& worker : _workerRequests)
+                    timeout += worker->_adaptiveTimeout->Get().count() / 1000.f;
+                timeout /= _workerRequests.size();
+            }
+        }
+        IE_SET_METRIC_RETURN(AUTO_BATCH_CURRENT_TIMEOUT, timeout);
+    } else if (name == METRIC_KEY(AUTO_BATCH_FILL_RATIO)) {
+        std::lock_guard<std::mutex> lock(_executionStatsMutex);
+        const float ratio = _numCollections ? static_cast<float>(_numCollectedRequests) /
+                                                  (_numCollections * std::max(1, _device.batchForDevice))
+                                            : 0.f;
+        IE_SET_METRIC_RETURN(AUTO_BATCH_FILL_RATIO, ratio);
+    } else if (name == METRIC_KEY(AUTO_BATCH_TIMEOUTS_FIRED)) {
+        std::lock_guard<std::mutex> lock(_executionStatsMutex);
+        IE_SET_METRIC_RETURN(AUTO_BATCH_TIMEOUTS_FIRED, _executionStats.at("timeouts"));
     } else if (name == ov::execution_devices) {
         return _networkWithoutBatch->GetMetric(name);
     } else {
@@ -688,6 +802,34 @@ DeviceInformation AutoBatchInferencePlugin::ParseBatchDevice(const std::string&
     return {deviceName, {{}}, batch};
 }
 
+std::set<int> AutoBatchInferencePlugin::ParsePartialBatches(const std::string& partialBatches, int batchForDevice) {
+    std::set<int> batches;
+    if (partialBatches == CONFIG_VALUE(NO))
+        return batches;
+    if (partialBatches == CONFIG_VALUE(YES)) {
+        for (int batch = 2; batch < batchForDevice; batch *= 2)
+            batches.insert(batch);
+        return batches;
+    }
+    std::stringstream stream(partialBatches);
+    std::string value;
+    while (std::getline(stream, value, ',')) {
+        int batch = 0;
+        try {
+            batch = std::stoi(value);
+        } catch (const std::exception&) {
+            IE_THROW(ParameterMismatch) << " Expecting YES/NO or the list of the batch sizes for "
+                                        << CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES) << " got " << partialBatches;
+        }
+        if (batch < 2)
+            IE_THROW(ParameterMismatch) << " The batch sizes of " << CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)
+                                        << " must be > 1, got " << partialBatches;
+        if (batch < batchForDevice)
+            batches.insert(batch);
+    }
+    return batches;
+}
+
 DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& devicesBatchCfg,
                                                             const std::map<std::string, std::string>& config) const {
     auto getDeviceConfig = [&](const DeviceName& deviceWithID) {
@@ -773,6 +915,17 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
                 IE_THROW(ParameterMismatch)
                     << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
             }
+        } else if (name == CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)) {
+            ParsePartialBatches(val, std::numeric_limits<int>::max());
+        } else if (name == CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)) {
+            try {
+                auto t = std::stoi(val);
+                if (t < 0)
+                    IE_THROW(ParameterMismatch);
+            } catch (const std::exception&) {
+                IE_THROW(ParameterMismatch)
+                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET) << " got " << val;
+            }
         }
     }
 }
@@ -790,6 +943,8 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = CONFIG_VALUE(NO);
+    _config[CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)] = "0";  // fixed timeout
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -959,27 +1114,46 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
+    auto loadNetworkWithBatch = [&](int batch) {
+        CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+        ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        reshaped.reshape(shapes);
+        return ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+    };
+
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = loadNetworkWithBatch(metaDevice.batchForDevice);
         } catch (...) {
             metaDevice.batchForDevice = 1;
         }
     }
 
+    // the ladder of the smaller batches to execute the requests collected by the moment of the timeout
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> executableNetworksPartialBatch;
+    const auto partial_batches = fullConfig.find(CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES));
+    if (executableNetworkWithBatch && partial_batches != fullConfig.end()) {
+        for (int batch : ParsePartialBatches(partial_batches->second, metaDevice.batchForDevice)) {
+            try {
+                executableNetworksPartialBatch[batch] = loadNetworkWithBatch(batch);
+            } catch (...) {
+                // the ladder is optional, the rung is missing and the timed-out requests fall back to the smaller
+                // batches or batch1
+            }
+        }
+    }
+
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
-                                                        batched_outputs);
+                                                        batched_outputs,
+                                                        executableNetworksPartialBatch);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(
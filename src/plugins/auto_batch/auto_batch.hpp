@@ -6,7 +6,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -29,6 +31,45 @@ struct DeviceInformation {
     int batchForDevice;
 };
 
+/**
+ * Latency-driven batch collection timeout of a worker (adaptive mode of the AUTO_BATCH_TIMEOUT).
+ * Tracks the requests inter-arrival time and the windows of the execution and end-to-end (arrival to completion)
+ * latencies, so the timeout is the largest one that keeps the p99 end-to-end latency within the target.
+ *
+ * Is a thread safe
+ */
+class AdaptiveTimeout {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    AdaptiveTimeout(int batchSize, std::chrono::microseconds initial);
+
+    void RecordArrival(Clock::time_point arrival);
+    void RecordExecution(Clock::duration execution, Clock::duration endToEnd);
+    // re-calculates the timeout for the given p99 latency target and returns it
+    std::chrono::microseconds Update(std::chrono::microseconds target);
+    std::chrono::microseconds Get() const {
+        return std::chrono::microseconds(_timeoutUs.load());
+    }
+
+protected:
+    static double Percentile(std::vector<double> samples, double p);
+
+    static constexpr size_t kWindow = 512;  // latency samples
+    static constexpr int64_t kMinTimeoutUs = 100;
+    const int _batchSize;
+    std::mutex _mutex;
+    Clock::time_point _lastArrival;
+    bool _hasArrival = false;
+    double _interArrivalUs = -1.0;  // moving average
+    std::vector<double> _executionUs;
+    std::vector<double> _endToEndUs;
+    size_t _nextSample = 0;
+    size_t _numNewSamples = 0;
+    double _correction = 1.0;
+    std::atomic<int64_t> _timeoutUs;
+};
+
 class AutoBatchAsyncInferRequest;
 class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
@@ -36,9 +77,17 @@ public:
     struct WorkerInferRequest {
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
+        // requests of the smaller batch networks (by the batch size) to execute the partially collected batches
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _inferRequestsPartialBatched;
+        // own blobs of these requests, to restore them after the blobs of the (full) batched request were shared
+        std::map<int, std::map<std::string, InferenceEngine::Blob::Ptr>> _partialBatchedBlobs;
         int _batchSize;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
+        // arrival times of the requests executed with the (full) batched request
+        std::vector<AdaptiveTimeout::Clock::time_point> _arrivalTimes;
+        AdaptiveTimeout::Clock::time_point _startTime;
+        std::unique_ptr<AdaptiveTimeout> _adaptiveTimeout;
         std::thread _thread;
         std::condition_variable _cond;
         std::mutex _mutex;
@@ -51,7 +100,8 @@ public:
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
-        const std::set<std::string>& batchedOutputs);
+        const std::set<std::string>& batchedOutputs,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksPartialBatch = {});
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
@@ -69,19 +119,32 @@ public:
 
 protected:
     static unsigned int ParseTimeoutValue(const std::string&);
+    std::chrono::microseconds GetTimeout(WorkerInferRequest& workerRequest);
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    // networks compiled for the smaller batch sizes, by the batch size
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _networksPartialBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
+    // executes the requests collected by the moment of the timeout with the largest fitting batches (or batch1)
+    void ExecutePartialBatch(WorkerInferRequest& workerRequest, int numRequests);
+    void UpdateExecutionStats(int batch, bool timeout);
+    void UpdateCollectionStats(int numRequests);
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
-    std::mutex _workerRequestsMutex;
+    mutable std::mutex _workerRequestsMutex;
 
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    std::atomic_int _latencyTarget = {0};  // p99 target in ms, enables the adaptive timeout
+
+    mutable std::mutex _executionStatsMutex;
+    std::map<std::string, uint64_t> _executionStats;
+    uint64_t _numCollections = 0;
+    uint64_t _numCollectedRequests = 0;
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
@@ -109,20 +172,43 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // copies the data to/from the given slot of another batched request (e.g. with the smaller batch)
+    void CopyInputsIfNeeded(InferenceEngine::SoIInferRequestInternal& req, size_t batchId, size_t batchSize);
+    void CopyOutputsIfNeeded(InferenceEngine::SoIInferRequestInternal& req, size_t batchId, size_t batchSize);
+    // true when the user works with the blobs sharing the memory of the request's slot of the batched request
+    bool AreBlobsSharedWithBatchRequest();
+    // sets the blobs sharing the [batch id, batch id + numSlots) slots of the batched request to another request,
+    // so it reads the inputs and writes the outputs directly to the memory of these slots (no copy)
+    void ShareBatchRequestSlotsWith(InferenceEngine::SoIInferRequestInternal& req, size_t numSlots);
+    size_t GetBatchId() const {
+        return _batchId;
+    }
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    // when the request was passed to the worker, to track the end-to-end latency
+    AdaptiveTimeout::Clock::time_point _arrivalTime;
+    // the smaller batch request used for the last PARTIAL_BATCH_EXECUTED inference
+    InferenceEngine::SoIInferRequestInternal _partialBatchedRequest;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
     size_t _batchSize;
+    // owned by the executable network
+    const std::set<std::string>& _batchedInputs;
+    const std::set<std::string>& _batchedOutputs;
 };
 
 class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
@@ -172,6 +258,8 @@ protected:
     std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
                                                           const DeviceName& deviceName) const;
     static DeviceInformation ParseBatchDevice(const std::string& deviceWithBatch);
+    // the batch sizes of the ladder (smaller than the device batch) for the AUTO_BATCH_PARTIAL_BATCHES value
+    static std::set<int> ParsePartialBatches(const std::string& partialBatches, int batchForDevice);
 
     InferenceEngine::IExecutableNetworkInternal::Ptr LoadNetworkImpl(
         const InferenceEngine::CNNNetwork& network,
@@ -0,0 +1,287 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace cache_footprint {
+// the footprint of the values which do not report it (roughly the page of the JIT code plus the object itself)
+constexpr size_t defaultFootprint = 4096;
+
+template<typename T>
+auto get(const T& value, int) -> decltype(static_cast<size_t>(value.getFootprint())) {
+    return value.getFootprint();
+}
+
+template<typename T>
+auto get(const std::shared_ptr<T>& value, int) -> decltype(static_cast<size_t>(value->getFootprint())) {
+    return value ? value->getFootprint() : 0;
+}
+
+template<typename T>
+size_t get(const T&, long) {  // NOLINT
+    return defaultFootprint;
+}
+}  // namespace cache_footprint
+
+/**
+ * @brief Returns the approximate memory footprint of the cached value in bytes.
+ *        The value (or the object it points to) may report it via the size_t getFootprint() const method,
+ *        otherwise the default estimation is used.
+ */
+template<typename T>
+size_t getCacheFootprint(const T& value) {
+    return cache_footprint::get(value, 0);
+}
+
+/**
+ * @brief The memory budget shared by several caches (e.g. all the entries of a MultiCache).
+ *
+ * When the budget is exceeded the records are evicted in the GreedyDual-Size order across all the attached caches.
+ * Every record has the priority = inflation + cost / bytes, where cost is the time it took to build the value.
+ * The record with the lowest priority is evicted first and its priority becomes the new inflation value, while a hit
+ * renews the priority of the record. So the records age as in the LRU policy, but the ones which are expensive to
+ * rebuild per byte of memory they hold stay in the cache longer.
+ *
+ * @attention This implementation IS NOT THREAD SAFE!
+ */
+class CacheBudget {
+public:
+    class Participant {
+    public:
+        virtual ~Participant() = default;
+        /**
+         * @brief Returns the priority of the record to be evicted next
+         * @return false if there are no records
+         */
+        virtual bool getLowestPriority(double& priority) const = 0;
+        /**
+         * @brief Evicts the record with the lowest priority
+         * @return number of released bytes
+         */
+        virtual size_t evictLowest() = 0;
+    };
+
+public:
+    explicit CacheBudget(size_t limit) : _limit(limit) {}
+
+    size_t getLimit() const noexcept {
+        return _limit;
+    }
+
+    // may be called from any thread
+    size_t getBytes() const noexcept {
+        return _bytes.load(std::memory_order_relaxed);
+    }
+
+    double getInflation() const noexcept {
+        return _inflation;
+    }
+
+    void attach(Participant* participant) {
+        _participants.push_back(participant);
+    }
+
+    void detach(Participant* participant) {
+        _participants.erase(std::remove(_participants.begin(), _participants.end(), participant), _participants.end());
+    }
+
+    /**
+     * @brief Accounts the bytes of the added record and evicts the records across the participants until the budget is met
+     * @return number of evicted records
+     */
+    size_t charge(size_t bytes) {
+        _bytes.fetch_add(bytes, std::memory_order_relaxed);
+        size_t evicted = 0;
+        while (getBytes() > _limit) {
+            Participant* victim = nullptr;
+            double lowest = 0;
+            for (auto participant : _participants) {
+                double priority = 0;
+                if (participant->getLowestPriority(priority) && (!victim || priority < lowest)) {
+                    victim = participant;
+                    lowest = priority;
+                }
+            }
+            if (!victim) {
+                break;
+            }
+            _inflation = lowest;
+            victim->evictLowest();
+            ++evicted;
+        }
+        return evicted;
+    }
+
+    void release(size_t bytes) {
+        _bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+private:
+    size_t _limit;
+    std::atomic<size_t> _bytes{0};
+    double _inflation = 0;
+    std::vector<Participant*> _participants;
+};
+
+/**
+ * @brief Preemptive cache, which besides the records limit respects the memory budget shared with other caches.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * The eviction order is described in the CacheBudget, with the records limit reached the record with the lowest
+ * priority of this cache is evicted.
+ *
+ * @attention This cache implementation IS NOT THREAD SAFE!
+ */
+template<typename Key, typename Value>
+class BudgetedLruCache : public CacheBudget::Participant {
+public:
+    using value_type = std::pair<Key, Value>;
+
+public:
+    BudgetedLruCache(size_t capacity, std::shared_ptr<CacheBudget> budget)
+        : _capacity(capacity),
+          _budget(std::move(budget)) {
+        _budget->attach(this);
+    }
+
+    BudgetedLruCache(const BudgetedLruCache&) = delete;
+    BudgetedLruCache& operator=(const BudgetedLruCache&) = delete;
+
+    ~BudgetedLruCache() override {
+        evict(_records.size());
+        _budget->detach(this);
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @param cost how expensive it is to recreate the value (e.g. the build time)
+     * @return number of records evicted to free the space for the new one
+     */
+
+    size_t put(const Key &key, const Value &val, double cost = 1.0) {
+        if (0 == _capacity) {
+            return 0;
+        }
+        size_t evicted = 0;
+        auto itr = _records.find(key);
+        if (itr != _records.end()) {
+            remove(itr);
+        } else if (_records.size() == _capacity) {
+            evictLowest();
+            evicted = 1;
+        }
+        const auto bytes = std::max<size_t>(1, getCacheFootprint(val));
+        Record record{val, bytes, std::max(cost, 0.0) / bytes, {}};
+        itr = _records.insert({key, std::move(record)}).first;
+        enqueue(itr);
+        return evicted + _budget->charge(bytes);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        auto itr = _records.find(key);
+        if (itr == _records.end()) {
+            return Value();
+        }
+        _queue.erase(itr->second.position);
+        enqueue(itr);
+        return itr->second.value;
+    }
+
+    /**
+     * @brief Evicts n records with the lowest priority
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (size_t i = 0; i < n && !_records.empty(); ++i) {
+            evictLowest();
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    bool getLowestPriority(double& priority) const override {
+        if (_queue.empty()) {
+            return false;
+        }
+        priority = _queue.begin()->first.first;
+        return true;
+    }
+
+    size_t evictLowest() override {
+        if (_queue.empty()) {
+            return 0;
+        }
+        auto itr = _records.find(_queue.begin()->second);
+        const auto bytes = itr->second.bytes;
+        remove(itr);
+        return bytes;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const Key &k) const {
+            return k.hash();
+        }
+    };
+
+    // ordered by the priority, the sequence number makes the equal priorities to be evicted in the LRU order
+    using queue_type = std::map<std::pair<double, uint64_t>, Key>;
+
+    struct Record {
+        Value value;
+        size_t bytes;
+        double costPerByte;
+        typename queue_type::iterator position;
+    };
+    using records_type = std::unordered_map<Key, Record, key_hasher>;
+
+    void enqueue(typename records_type::iterator itr) {
+        const auto priority = _budget->getInflation() + itr->second.costPerByte;
+        itr->second.position = _queue.insert({{priority, _sequence++}, itr->first}).first;
+    }
+
+    void remove(typename records_type::iterator itr) {
+        _budget->release(itr->second.bytes);
+        _queue.erase(itr->second.position);
+        _records.erase(itr);
+    }
+
+    records_type _records;
+    queue_type _queue;
+    uint64_t _sequence = 0;
+    size_t _capacity;
+    std::shared_ptr<CacheBudget> _budget;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <functional>
 #include "lru_cache.h"
@@ -17,6 +20,16 @@ public:
         Hit,
         Miss
     };
+
+    /**
+     * @brief Lookup counters, may be shared by several entries (e.g. all the entries of a MultiCache)
+     */
+    struct Statistics {
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> evictions{0};
+    };
+
 public:
     virtual ~CacheEntryBase() = default;
 };
@@ -25,8 +38,10 @@ public:
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide size_t put(KeyType, ValueType) (returning the number
+ *         of evicted records) and ValueType get(const KeyType&) interface and must have constructor of type ImplType(size_t, ...).
+ *         If the storage provides size_t put(KeyType, ValueType, double cost) the build time (in microseconds) is passed
+ *         as the cost of the record.
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -39,7 +54,21 @@ public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
 public:
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    /**
+     * @param capacity maximum number of records
+     * @param statistics optional lookup counters to be updated by the entry
+     */
+    explicit CacheEntry(size_t capacity, Statistics* statistics = nullptr) : _impl(capacity), _statistics(statistics) {}
+
+    /**
+     * @param capacity maximum number of records
+     * @param statistics optional lookup counters to be updated by the entry
+     * @param implArgs additional arguments of the underlying storage constructor
+     */
+    template<typename... ImplArgs>
+    CacheEntry(size_t capacity, Statistics* statistics, ImplArgs&&... implArgs)
+        : _impl(capacity, std::forward<ImplArgs>(implArgs)...),
+          _statistics(statistics) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -52,22 +81,46 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            if (_statistics)
+                _statistics->misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
         ValType retVal = _impl.get(key);
         auto retEmpty = ValType();
+        size_t evicted = 0;
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            const auto start = std::chrono::steady_clock::now();
             retVal = builder(key);
+            const std::chrono::duration<double, std::micro> buildTime = std::chrono::steady_clock::now() - start;
             if (retVal != retEmpty)
-                _impl.put(key, retVal);
+                evicted = put(_impl, key, retVal, buildTime.count(), 0);
+        }
+        if (_statistics) {
+            (LookUpStatus::Hit == retStatus ? _statistics->hits : _statistics->misses).fetch_add(1, std::memory_order_relaxed);
+            if (evicted)
+                _statistics->evictions.fetch_add(evicted, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
 public:
     ImplType _impl;
+
+private:
+    template<typename Impl>
+    static auto put(Impl& impl, const KeyType& key, const ValType& val, double cost, int)
+        -> decltype(impl.put(key, val, cost)) {
+        return impl.put(key, val, cost);
+    }
+
+    template<typename Impl>
+    static size_t put(Impl& impl, const KeyType& key, const ValType& val, double, long) {  // NOLINT
+        return impl.put(key, val);
+    }
+
+    Statistics* _statistics;
 };
 
 }   // namespace intel_cpu
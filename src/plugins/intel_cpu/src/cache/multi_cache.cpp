@@ -4,10 +4,26 @@
 
 #include "multi_cache.h"
 
+#include <map>
+
 namespace ov {
 namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+std::shared_ptr<MultiCache> MultiCache::getSharedInstance(size_t capacity) {
+    static std::mutex mutex;
+    static std::map<size_t, std::weak_ptr<MultiCache>> instances;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& instance = instances[capacity];
+    auto cache = instance.lock();
+    if (!cache) {
+        cache = std::make_shared<MultiCache>(capacity, true);
+        instance = cache;
+    }
+    return cache;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -7,31 +7,78 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
+#include <type_traits>
+#include <onednn/dnnl.h>
+#include "budgeted_lru_cache.h"
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Whether a cached value may be executed by several threads at once, i.e. it keeps no state of the execution.
+ * These are the oneDNN primitives and the executors which declare `static constexpr bool reentrant = true`
+ * (e.g. DnnlExecutor), the other executors keep their buffers and must not be shared between concurrent users.
+ */
+template<typename ValueType, typename = void>
+struct IsReentrant : std::is_base_of<dnnl::primitive, ValueType> {};
+
+template<typename T>
+struct IsReentrant<std::shared_ptr<T>, typename std::enable_if<T::reentrant>::type> : std::true_type {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE, unless it is created as thread safe
+ *            (then the entries are sharded and the lookups do not block, see ShardedLruCache).
+ *
+ * Besides the records limit per entry, the cache may be given the memory budget for all the entries together
+ * (see CacheBudget), the budget is not supported by the thread safe cache.
+ *
+ * The reentrant values (see IsReentrant) may be delegated to another cache shared by the concurrent users, while
+ * the other values stay in this cache or aren't cached at all if this cache is used concurrently itself.
  */
 
 class MultiCache {
 public:
-    template<typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template<typename KeyType, typename ValueType, typename ImplType = LruCache<KeyType, ValueType>>
+    using EntryTypeT = CacheEntry<KeyType, ValueType, ImplType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
-    template<typename KeyType, typename ValueType>
-    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    template<typename KeyType, typename ValueType, typename ImplType = LruCache<KeyType, ValueType>>
+    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType, ImplType>>;
+    using Statistics = CacheEntryBase::Statistics;
 
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe whether the cache may be used from several threads concurrently
+    * @param budget memory budget for all the records in bytes, zero means no budget
+    * @param reentrantCache the cache to keep the reentrant values instead of this one, e.g. the process-wide cache
+    * @param cacheStateful whether to keep the values which aren't reentrant, false if the users of this cache
+    *        execute the values concurrently (then every lookup of such a value builds a new one)
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false, size_t budget = 0,
+                        std::shared_ptr<MultiCache> reentrantCache = nullptr, bool cacheStateful = true)
+        : _capacity(capacity),
+          _threadSafe(threadSafe),
+          _budget(budget && !threadSafe ? std::make_shared<CacheBudget>(budget) : nullptr),
+          _reentrantCache(std::move(reentrantCache)),
+          _cacheStateful(cacheStateful),
+          _storage(std::make_shared<Storage>()) {}
+
+    MultiCache(const MultiCache&) = delete;
+    MultiCache& operator=(const MultiCache&) = delete;
+
+    /**
+    * @brief Returns the process-wide thread safe cache of the given capacity, the cache lives as long as somebody uses it.
+    *        It is meant to be the reentrant values cache of the per stream caches, so the executors with the state
+    *        aren't shared by the streams
+    * @param capacity the same as for the constructor
+    */
+    static std::shared_ptr<MultiCache> getSharedInstance(size_t capacity);
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,20 +92,65 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
+        if (IsReentrant<ValueType>::value) {
+            if (_reentrantCache)
+                return _reentrantCache->getOrCreate(key, std::move(builder));
+        } else if (!_cacheStateful) {
+            _statistics.misses.fetch_add(1, std::memory_order_relaxed);
+            return {builder(key), CacheEntryBase::LookUpStatus::Miss};
+        }
+        if (_threadSafe) {
+            auto entry = getEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        if (_budget) {
+            auto entry = getEntry<KeyType, ValueType, BudgetedLruCache<KeyType, ValueType>>(_budget);
+            return entry->getOrCreate(key, std::move(builder));
+        }
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the hit/miss/eviction counters accumulated over all the entries
+    */
+    const Statistics& getStatistics() const noexcept {
+        return _statistics;
+    }
+
+    /**
+    * @brief Returns the approximate memory footprint of all the records (tracked only when the cache has the budget)
+    */
+    size_t getBytes() const noexcept {
+        return _budget ? _budget->getBytes() : 0;
+    }
+
+    /**
+    * @brief Returns the cache keeping the reentrant values instead of this one, if any
+    */
+    const std::shared_ptr<MultiCache>& getReentrantCache() const noexcept {
+        return _reentrantCache;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
-    template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template<typename KeyType, typename ValueType, typename ImplType = LruCache<KeyType, ValueType>, typename... ImplArgs>
+    EntryPtr<KeyType, ValueType, ImplType> getEntry(ImplArgs&&... implArgs);
 
 private:
+    // immutable, the new entry is added to the copy, which is published then (atomically in the thread safe mode)
+    using Storage = std::unordered_map<size_t, EntryBasePtr>;
+
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
-    std::unordered_map<size_t, EntryBasePtr> _storage;
+    bool _threadSafe;
+    std::shared_ptr<CacheBudget> _budget;
+    std::shared_ptr<MultiCache> _reentrantCache;
+    bool _cacheStateful;
+    std::shared_ptr<const Storage> _storage;
+    std::mutex _storageMutex;
+    Statistics _statistics;
 };
 
 template<typename T>
@@ -67,16 +159,29 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename KeyType, typename ValueType, typename ImplType, typename... ImplArgs>
+MultiCache::EntryPtr<KeyType, ValueType, ImplType> MultiCache::getEntry(ImplArgs&&... implArgs) {
+    using EntryType = EntryTypeT<KeyType, ValueType, ImplType>;
     size_t id = getTypeId<EntryType>();
-    auto itr = _storage.find(id);
-    if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
-        itr = result.first;
+    auto storage = _threadSafe ? std::atomic_load(&_storage) : _storage;
+    auto itr = storage->find(id);
+    if (itr != storage->end()) {
+        return std::static_pointer_cast<EntryType>(itr->second);
+    }
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (_threadSafe) {
+        lock.lock();
+    }
+    // the entry might have been added by another thread while waiting for the lock
+    auto newStorage = std::make_shared<Storage>(*_storage);
+    auto result = newStorage->insert({id, std::make_shared<EntryType>(_capacity, &_statistics, std::forward<ImplArgs>(implArgs)...)});
+    auto entry = std::static_pointer_cast<EntryType>(result.first->second);
+    if (_threadSafe) {
+        std::atomic_store(&_storage, std::shared_ptr<const Storage>(std::move(newStorage)));
+    } else {
+        _storage = std::move(newStorage);
     }
-    return std::static_pointer_cast<EntryType>(itr->second);
+    return entry;
 }
 
 using MultiCachePtr = std::shared_ptr<MultiCache>;
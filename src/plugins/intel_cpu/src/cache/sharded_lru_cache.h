@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Thread safe implementation of a preemptive cache with approximated LRU eviction policy.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * The records are distributed over the shards by the key hash. The lookup reads the immutable snapshot of the shard
+ * records, so it never waits for the writers, which serialize on the shard mutex and publish the updated copy of
+ * the shard snapshot. Instead of reordering the LRU list on every lookup, the lookup marks the record as referenced
+ * and the eviction uses the CLOCK (second chance) policy.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ShardedLruCache {
+public:
+    using value_type = std::pair<Key, Value>;
+
+public:
+    explicit ShardedLruCache(size_t capacity, size_t numShards = 16)
+        : _capacity(capacity),
+          _numShards(std::max<size_t>(1, std::min(numShards, capacity))),
+          _shardCapacity((capacity + _numShards - 1) / _numShards),
+          _shards(new Shard[_numShards]) {}
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @return number of records evicted to free the space for the new one
+     */
+
+    size_t put(const Key &key, const Value &val) {
+        if (0 == _capacity) {
+            return 0;
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto records = std::make_shared<Records>(*shard.records);
+        auto record = std::make_shared<Record>(key, val);
+        size_t evicted = 0;
+        auto itr = records->find(key);
+        if (itr != records->end()) {
+            std::replace(shard.clock.begin(), shard.clock.end(), itr->second, record);
+            itr->second = record;
+        } else {
+            if (shard.clock.size() == _shardCapacity) {
+                evictOne(shard, *records);
+                evicted = 1;
+            }
+            records->insert({key, record});
+            // right behind the hand, so the new record is the last one to be visited
+            shard.clock.insert(shard.clock.begin() + shard.hand, record);
+            shard.hand = (shard.hand + 1) % shard.clock.size();
+        }
+        std::atomic_store(&shard.records, std::shared_ptr<const Records>(std::move(records)));
+        return evicted;
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        const auto records = std::atomic_load(&getShard(key).records);
+        auto itr = records->find(key);
+        if (itr == records->end()) {
+            return Value();
+        }
+        itr->second->referenced.store(true, std::memory_order_relaxed);
+        return itr->second->value;
+    }
+
+    /**
+     * @brief Evicts n cache records (the shards are visited in turn)
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (size_t i = 0; i < _numShards && n; ++i) {
+            auto& shard = _shards[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto records = std::make_shared<Records>(*shard.records);
+            for (; n && evictOne(shard, *records); --n) {}
+            std::atomic_store(&shard.records, std::shared_ptr<const Records>(std::move(records)));
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const Key &k) const {
+            return k.hash();
+        }
+    };
+
+    struct Record {
+        Record(const Key& key, const Value& value) : key(key), value(value) {}
+        const Key key;
+        const Value value;
+        std::atomic<bool> referenced{false};
+    };
+    using RecordPtr = std::shared_ptr<Record>;
+    using Records = std::unordered_map<Key, RecordPtr, key_hasher>;
+
+    struct Shard {
+        std::shared_ptr<const Records> records = std::make_shared<Records>();  // published snapshot
+        std::mutex mutex;                                                       // serializes the writers
+        std::vector<RecordPtr> clock;
+        size_t hand = 0;
+    };
+
+    Shard& getShard(const Key& key) {
+        const size_t hash = key.hash();
+        // the lower bits are used by the shard's hash table
+        return _shards[(hash ^ (hash >> 16)) % _numShards];
+    }
+
+    // the shard mutex must be held
+    bool evictOne(Shard& shard, Records& records) {
+        if (shard.clock.empty()) {
+            return false;
+        }
+        while (shard.clock[shard.hand]->referenced.exchange(false, std::memory_order_relaxed)) {
+            shard.hand = (shard.hand + 1) % shard.clock.size();
+        }
+        records.erase(shard.clock[shard.hand]->key);
+        shard.clock.erase(shard.clock.begin() + shard.hand);
+        if (shard.hand >= shard.clock.size()) {
+            shard.hand = 0;
+        }
+        return true;
+    }
+
+    size_t _capacity;
+    size_t _numShards;
+    size_t _shardCapacity;
+    std::unique_ptr<Shard[]> _shards;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
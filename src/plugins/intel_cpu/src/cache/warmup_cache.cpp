@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "warmup_cache.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr const char* fileHeader = "OV_CPU_WARMUP_CACHE 1";
+}   // namespace
+
+constexpr size_t WarmupCache::defaultCapacity;
+
+WarmupCache::WarmupCache(const std::string& cacheDir, std::string key, size_t capacity)
+    : _key(std::move(key)),
+      _capacity(capacity) {
+    // the key is stored in the file as a single line
+    for (auto& c : _key) {
+        if (c == '\n' || c == '\r')
+            c = ' ';
+    }
+    std::stringstream name;
+    name << "cpu_warmup_" << std::hex << std::hash<std::string>()(_key) << ".txt";
+    _path = ov::util::path_join({cacheDir, name.str()});
+    load();
+}
+
+std::vector<WarmupCache::InputShapes> WarmupCache::getShapes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _shapes;
+}
+
+bool WarmupCache::record(const InputShapes& shapes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_shapes.size() >= _capacity || !_index.insert(shapes).second)
+        return false;
+    _shapes.push_back(shapes);
+    save();
+    return true;
+}
+
+void WarmupCache::load() {
+    std::ifstream file(_path);
+    std::string line;
+    if (!std::getline(file, line) || line != fileHeader)
+        return;
+    if (!std::getline(file, line) || line != _key)
+        return;
+    InputShapes shapes;
+    while (_shapes.size() < _capacity && std::getline(file, line)) {
+        if (fromString(line, shapes) && _index.insert(shapes).second)
+            _shapes.push_back(shapes);
+    }
+}
+
+void WarmupCache::save() const {
+    // write to the unique temporary file and replace the cache file, so the readers never see the partial file
+    std::stringstream tmpPath;
+    tmpPath << _path << "." << std::hex << reinterpret_cast<uintptr_t>(this)
+            << std::chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
+    {
+        std::ofstream file(tmpPath.str(), std::ios::trunc);
+        if (!file)
+            return;
+        file << fileHeader << "\n" << _key << "\n";
+        for (const auto& shapes : _shapes)
+            file << toString(shapes) << "\n";
+        if (!file) {
+            file.close();
+            std::remove(tmpPath.str().c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpPath.str().c_str(), _path.c_str()) != 0) {
+        // rename does not replace the existing file on Windows
+        std::remove(_path.c_str());
+        if (std::rename(tmpPath.str().c_str(), _path.c_str()) != 0)
+            std::remove(tmpPath.str().c_str());
+    }
+}
+
+// the dims are separated by ',' and the inputs by ';', e.g. "1,3,224,224;1,10"
+std::string WarmupCache::toString(const InputShapes& shapes) {
+    std::stringstream str;
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        if (i)
+            str << ";";
+        for (size_t j = 0; j < shapes[i].size(); ++j) {
+            if (j)
+                str << ",";
+            str << shapes[i][j];
+        }
+    }
+    return str.str();
+}
+
+bool WarmupCache::fromString(const std::string& str, InputShapes& shapes) {
+    shapes.clear();
+    std::stringstream input(str);
+    std::string shapeStr;
+    while (std::getline(input, shapeStr, ';')) {
+        VectorDims dims;
+        std::stringstream shape(shapeStr);
+        std::string dimStr;
+        while (std::getline(shape, dimStr, ',')) {
+            if (dimStr.empty() || dimStr.find_first_not_of("0123456789") != std::string::npos)
+                return false;
+            try {
+                dims.push_back(std::stoull(dimStr));
+            } catch (const std::out_of_range&) {
+                return false;
+            }
+        }
+        shapes.push_back(std::move(dims));
+    }
+    // trailing scalar input is not reported by getline
+    if (!str.empty() && str.back() == ';')
+        shapes.emplace_back();
+    return !shapes.empty();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Persistent record of the input shapes a dynamic graph has been executed with.
+ *
+ * The JIT kernels and oneDNN primitives of a dynamic graph are generated on the first inference with a new input
+ * shape. The generated code cannot be stored itself (the CPU JIT code is not relocatable and oneDNN does not support
+ * cache blobs for the CPU engine), so the cache stores the shapes the kernels were generated for instead. When the
+ * graph is created again, e.g. after the process restart, the kernels for these shapes are generated ahead of the
+ * first inference (see Graph::WarmUp).
+ *
+ * The records are kept in a small text file in the cache directory, the file is identified by the key, which
+ * describes the model and the host ISA. The file is rewritten every time a new shape is recorded, concurrent writers
+ * do not corrupt the file, but the last one wins.
+ *
+ * The class is thread safe.
+ */
+class WarmupCache {
+public:
+    using Ptr = std::shared_ptr<WarmupCache>;
+    using InputShapes = std::vector<VectorDims>;
+
+public:
+    /**
+     * @param cacheDir directory to store the file in
+     * @param key identifies the model and the host, the records made for another key are ignored
+     * @param capacity maximum number of the recorded shapes
+     */
+    WarmupCache(const std::string& cacheDir, std::string key, size_t capacity = defaultCapacity);
+
+    /**
+     * @brief Returns the recorded shapes in the order they were recorded
+     */
+    std::vector<InputShapes> getShapes() const;
+
+    /**
+     * @brief Records the shapes and saves the file if the shapes are new and the capacity allows
+     * @return true if the shapes have been recorded
+     */
+    bool record(const InputShapes& shapes);
+
+    const std::string& getPath() const noexcept {
+        return _path;
+    }
+
+    static constexpr size_t defaultCapacity = 64;
+
+private:
+    void load();
+    void save() const;
+
+    static std::string toString(const InputShapes& shapes);
+    static bool fromString(const std::string& str, InputShapes& shapes);
+
+    std::string _path;
+    std::string _key;
+    size_t _capacity;
+
+    mutable std::mutex _mutex;
+    std::vector<InputShapes> _shapes;
+    std::set<InputShapes> _index;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compiled_constants.h"
+
+#include <cstring>
+#include <sstream>
+
+#include "onednn/dnnl.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr char sectionMagic[] = "OV_CPU_CONSTS_1";
+
+void writeSize(std::ostream& stream, uint64_t size) {
+    stream.write(reinterpret_cast<const char*>(&size), sizeof size);
+}
+
+bool readSize(std::istream& stream, uint64_t& size) {
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&size), sizeof size));
+}
+
+void writeString(std::ostream& stream, const std::string& str) {
+    writeSize(stream, str.size());
+    stream.write(str.data(), str.size());
+}
+
+bool readString(std::istream& stream, std::string& str) {
+    uint64_t size = 0;
+    if (!readSize(stream, size))
+        return false;
+    str.resize(size);
+    return static_cast<bool>(stream.read(&str[0], size));
+}
+
+std::string hostIsa() {
+    return std::to_string(static_cast<int>(dnnl::get_effective_cpu_isa()));
+}
+}   // namespace
+
+bool CompiledConstants::isSupported(const MemoryDesc& desc) {
+    return desc.isDefined() && (desc.getType() & MemoryDescType::Blocked);
+}
+
+std::string CompiledConstants::descKey(const MemoryDesc& desc) {
+    std::stringstream key;
+    key << desc.getPrecision().name() << " " << desc.getShape().toString() << " " << desc.serializeFormat() << " "
+        << desc.getCurrentMemSize();
+    return key.str();
+}
+
+void CompiledConstants::write(std::ostream& stream, const std::vector<NamedMemory>& constants) {
+    stream.write(sectionMagic, sizeof sectionMagic);
+    writeString(stream, hostIsa());
+    writeSize(stream, constants.size());
+    for (const auto& constant : constants) {
+        const auto& memory = constant.second;
+        writeString(stream, constant.first);
+        writeString(stream, descKey(memory->getDesc()));
+        writeSize(stream, memory->GetSize());
+        stream.write(static_cast<const char*>(memory->GetData()), memory->GetSize());
+    }
+}
+
+CompiledConstants::Ptr CompiledConstants::read(std::istream& stream) {
+    char magic[sizeof sectionMagic] = {};
+    if (!stream.read(magic, sizeof magic) || std::memcmp(magic, sectionMagic, sizeof magic) != 0)
+        return nullptr;
+
+    std::string isa;
+    uint64_t count = 0;
+    if (!readString(stream, isa) || isa != hostIsa() || !readSize(stream, count))
+        return nullptr;
+
+    // the data is skipped, so the stream must be seekable
+    const auto indexBegin = stream.tellg();
+    if (indexBegin < 0 || !stream.seekg(0, std::ios::end))
+        return nullptr;
+    const auto streamEnd = stream.tellg();
+    stream.seekg(indexBegin);
+
+    auto result = std::make_shared<CompiledConstants>();
+    result->_stream = &stream;
+    for (uint64_t i = 0; i < count; i++) {
+        std::string name;
+        Constant constant;
+        if (!readString(stream, name) || !readString(stream, constant.desc) || !readSize(stream, constant.size))
+            return nullptr;
+        constant.offset = stream.tellg();
+        if (constant.size > static_cast<uint64_t>(static_cast<std::streamoff>(streamEnd) - constant.offset) ||
+            !stream.seekg(static_cast<std::streamoff>(constant.size), std::ios::cur))
+            return nullptr;
+        result->_constants.emplace(std::move(name), std::move(constant));
+    }
+    return result;
+}
+
+bool CompiledConstants::load(const std::string& edgeName, const MemoryDesc& desc, void* dst, size_t size) const {
+    auto it = _constants.find(edgeName);
+    if (it == _constants.end() || it->second.size != size || !isSupported(desc) || it->second.desc != descKey(desc))
+        return false;
+
+    std::lock_guard<std::mutex> lock(_streamMutex);
+    _stream->clear();
+    const auto position = _stream->tellg();
+    const bool loaded = _stream->seekg(it->second.offset) &&
+                        _stream->read(static_cast<char*>(dst), static_cast<std::streamsize>(size));
+    _stream->clear();
+    _stream->seekg(position);
+    return loaded;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
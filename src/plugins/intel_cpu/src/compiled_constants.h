@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief The constant tensors computed during the graph compilation: the weights reordered to the layouts of the
+ * selected primitives and the results of the constant subgraphs.
+ *
+ * The tensors are stored with the exported network, the import restores them instead of executing the constant part
+ * of the graph again (see Graph::ExecuteConstantNodesOnly). Every tensor is identified by the name of the graph edge
+ * and its memory descriptor, so a tensor is used only if the graph compiled on import selects the same layout for the
+ * edge. The whole section is ignored if the network is imported on the host with another ISA.
+ *
+ * On import only the index of the section is read, the data is read from the stream straight to the edge memory.
+ */
+class CompiledConstants {
+public:
+    using Ptr = std::shared_ptr<CompiledConstants>;
+    using CPtr = std::shared_ptr<const CompiledConstants>;
+    using NamedMemory = std::pair<std::string, MemoryCPtr>;
+
+    /**
+     * @brief Appends the section with the constants to the stream
+     */
+    static void write(std::ostream& stream, const std::vector<NamedMemory>& constants);
+
+    /**
+     * @brief Reads the index of the section from the current position of the stream, the stream is positioned after
+     * the section. The stream must outlive the returned object, the data is read from it by load().
+     * @return nullptr if the stream has no valid section for the host
+     */
+    static Ptr read(std::istream& stream);
+
+    /**
+     * @brief Reads the data of the edge constant to dst if it has been computed for the same descriptor and size
+     * @return false if there is no such constant or the data can't be read
+     */
+    bool load(const std::string& edgeName, const MemoryDesc& desc, void* dst, size_t size) const;
+
+    size_t size() const noexcept {
+        return _constants.size();
+    }
+
+    static bool isSupported(const MemoryDesc& desc);
+
+private:
+    static std::string descKey(const MemoryDesc& desc);
+
+    struct Constant {
+        std::string desc;
+        std::streamoff offset;
+        uint64_t size;
+    };
+
+    std::unordered_map<std::string, Constant> _constants;
+    std::istream* _stream = nullptr;
+    // the graphs of the streams are compiled in parallel
+    mutable std::mutex _streamMutex;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
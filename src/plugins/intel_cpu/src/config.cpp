@@ -167,6 +167,8 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             }
         } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
             cache_dir = val;
+        } else if (key == PluginConfigInternalParams::KEY_CACHED_BLOB_PATH) {
+            cachedBlobPath = val;
         } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY == key) {
             int val_i = -1;
             try {
@@ -178,6 +180,84 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_BUDGET == key) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_BUDGET
+                           << ". Expected only integer numbers";
+            }
+            // any negative value is treated as zero that means no budget
+            rtCacheBudget = static_cast<size_t>(std::max(val_i, 0ll));
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_RUNTIME_CACHE == key) {
+            if (val == PluginConfigParams::YES)
+                rtCacheShared = true;
+            else if (val == PluginConfigParams::NO)
+                rtCacheShared = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_RUNTIME_CACHE
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_PACKED_WEIGHTS == key) {
+            if (val == PluginConfigParams::YES)
+                packedWeightsShared = true;
+            else if (val == PluginConfigParams::NO)
+                packedWeightsShared = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_PACKED_WEIGHTS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_NUMA_WEIGHTS_BINDING == key) {
+            if (val == PluginConfigParams::YES)
+                numaWeightsBinding = true;
+            else if (val == PluginConfigParams::NO)
+                numaWeightsBinding = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_NUMA_WEIGHTS_BINDING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA == key) {
+            if (val == PluginConfigParams::YES)
+                dynamicMemoryArena = true;
+            else if (val == PluginConfigParams::NO)
+                dynamicMemoryArena = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA_SHRINK == key) {
+            if (val == PluginConfigParams::YES)
+                dynamicMemoryArenaShrink = true;
+            else if (val == PluginConfigParams::NO)
+                dynamicMemoryArenaShrink = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA_SHRINK
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_EMBEDDING_TABLE_QUANTIZATION == key) {
+            if (val == PluginConfigParams::NO)
+                embeddingTableQuantization = EmbeddingTableQuantization::ETQ_Off;
+            else if (val == PluginConfigInternalParams::INT8)
+                embeddingTableQuantization = EmbeddingTableQuantization::ETQ_Int8;
+            else if (val == PluginConfigInternalParams::INT4)
+                embeddingTableQuantization = EmbeddingTableQuantization::ETQ_Int4;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EMBEDDING_TABLE_QUANTIZATION
+                           << ". Expected values: NO/INT8/INT4";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES == key) {
+            if (val == PluginConfigParams::YES)
+                parallelBranches = true;
+            else if (val == PluginConfigParams::NO)
+                parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_VARIABLE_STATE_RESERVE == key) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_VARIABLE_STATE_RESERVE
+                           << ". Expected only integer numbers";
+            }
+            // any negative value is treated as zero that means no reserve
+            variableStateReserve = static_cast<size_t>(std::max(val_i, 0ll));
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
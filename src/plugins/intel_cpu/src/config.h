@@ -38,6 +38,12 @@ struct Config {
         Disable,
     };
 
+    enum EmbeddingTableQuantization {
+        ETQ_Off,
+        ETQ_Int8,
+        ETQ_Int4,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -46,6 +52,15 @@ struct Config {
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
     size_t rtCacheCapacity = 5000ul;
+    bool rtCacheShared = false;
+    size_t rtCacheBudget = 0ul;
+    bool parallelBranches = false;
+    size_t variableStateReserve = 0ul;
+    bool packedWeightsShared = false;
+    bool numaWeightsBinding = true;
+    bool dynamicMemoryArena = false;
+    bool dynamicMemoryArenaShrink = false;
+    EmbeddingTableQuantization embeddingTableQuantization = EmbeddingTableQuantization::ETQ_Off;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
@@ -60,6 +75,8 @@ struct Config {
 #endif
 
     std::string cache_dir{};
+    // the cache file the network is imported from (passed by the core on import)
+    std::string cachedBlobPath{};
 
     DenormalsOptMode denormalsOptMode = DenormalsOptMode::DO_Keep;
 
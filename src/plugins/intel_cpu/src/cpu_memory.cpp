@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <vector>
 #include <numeric>
 #include <unordered_set>
@@ -16,6 +17,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/numa_memory.hpp"
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -199,6 +201,75 @@ bool MemoryMngrWithReuse::hasExtBuffer() const noexcept {
     return _useExternalStorage;
 }
 
+void* MemoryMngrWithGrowth::getRawPtr() const noexcept {
+    return _mngr.getRawPtr();
+}
+
+void MemoryMngrWithGrowth::setExtBuff(void *ptr, size_t size) {
+    _mngr.setExtBuff(ptr, size);
+    _capacity = size;
+}
+
+bool MemoryMngrWithGrowth::resize(size_t size) {
+    if (size <= _capacity)
+        return false;
+    _capacity = std::max(std::max(size, 2 * _capacity), _reserve);
+    return _mngr.resize(_capacity);
+}
+
+bool MemoryMngrWithGrowth::hasExtBuffer() const noexcept {
+    return _mngr.hasExtBuffer();
+}
+
+MemoryMngrOnNumaNode::~MemoryMngrOnNumaNode() {
+    release();
+}
+
+void* MemoryMngrOnNumaNode::getRawPtr() const noexcept {
+    return _data;
+}
+
+void MemoryMngrOnNumaNode::setExtBuff(void *ptr, size_t size) {
+    release();
+    _useExternalStorage = true;
+    _data = ptr;
+    _size = size;
+}
+
+bool MemoryMngrOnNumaNode::resize(size_t size) {
+    constexpr int cacheLineSize = 64;
+    if (size <= _size)
+        return false;
+    release();
+    _data = allocateOnNumaNode(size, _numaNodeId);
+    _onNumaNode = _data != nullptr;
+    if (!_data)
+        _data = dnnl::impl::malloc(size, cacheLineSize);
+    if (!_data) {
+        _size = 0;
+        IE_THROW() << "Failed to allocate " << size << " bytes of memory";
+    }
+    _size = size;
+    return true;
+}
+
+bool MemoryMngrOnNumaNode::hasExtBuffer() const noexcept {
+    return _useExternalStorage;
+}
+
+void MemoryMngrOnNumaNode::release() {
+    if (!_useExternalStorage) {
+        if (_onNumaNode)
+            freeOnNumaNode(_data, _size);
+        else
+            dnnl::impl::free(_data);
+    }
+    _data = nullptr;
+    _size = 0;
+    _useExternalStorage = false;
+    _onNumaNode = false;
+}
+
 void MemoryMngrWithReuse::release(void *ptr) {}
 
 void MemoryMngrWithReuse::destroy(void *ptr) {
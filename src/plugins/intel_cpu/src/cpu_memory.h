@@ -89,6 +89,49 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief An implementation of the mem manager for the tensors growing step by step (e.g. the variable states of the
+ * sequence models): the buffer capacity is at least doubled on every reallocation, so the number of reallocations is
+ * logarithmic in the final size. The first allocation reserves at least the requested number of bytes.
+ */
+class MemoryMngrWithGrowth : public IMemoryMngr {
+public:
+    explicit MemoryMngrWithGrowth(size_t reserve = 0) : _reserve(reserve) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    MemoryMngrWithReuse _mngr;
+    size_t _capacity = 0ul;
+    size_t _reserve = 0ul;
+};
+
+/**
+ * @brief An implementation of the mem manager placing the memory on the NUMA node: every buffer is a dedicated mapping
+ * with the node preferred for its pages (e.g. the packed weights used by the streams of the node). Falls back to the
+ * regular allocation if the placement isn't supported.
+ */
+class MemoryMngrOnNumaNode : public IMemoryMngr {
+public:
+    explicit MemoryMngrOnNumaNode(int numaNodeId) : _numaNodeId(numaNodeId) {}
+    ~MemoryMngrOnNumaNode() override;
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    void release();
+
+    int _numaNodeId;
+    void* _data = nullptr;
+    size_t _size = 0ul;
+    bool _useExternalStorage = false;
+    bool _onNumaNode = false;
+};
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
@@ -16,15 +16,24 @@ namespace intel_cpu {
 class DnnlScratchPad {
     DnnlMemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    bool shared = true;
 
 public:
-    DnnlScratchPad(dnnl::engine eng) : eng(eng) {
+    /**
+     * @param shared if false, every scratch pad memory gets its own manager. Required when nodes
+     * of the same graph may be executed concurrently (see Config::parallelBranches)
+     */
+    DnnlScratchPad(dnnl::engine eng, bool shared = true) : eng(eng), shared(shared) {
         mgrPtr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
         auto mem = std::make_shared<Memory>(eng);
-        mem->Create(md, mgrPtr);
+        if (shared) {
+            mem->Create(md, mgrPtr);
+        } else {
+            mem->Create(md, std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())));
+        }
         return mem;
     }
 };
@@ -14,6 +14,7 @@
 #include "serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
+#include "utils/numa_memory.hpp"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -24,12 +25,14 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
+#include <sstream>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -65,12 +68,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         CompiledConstants::CPtr compiledConstants) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _compiledConstants(std::move(compiledConstants)) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -119,6 +124,16 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (!_cfg.cache_dir.empty() && function->is_dynamic()) {
+        // the recorded shapes are valid for the same model and the kernels are generated for the same ISA
+        std::stringstream key;
+        key << _name << " isa:" << static_cast<int>(dnnl::get_effective_cpu_isa())
+            << " ops:" << function->get_ops().size();
+        for (const auto& param : function->get_parameters()) {
+            key << " " << param->get_friendly_name() << ":" << param->get_element_type() << param->get_partial_shape();
+        }
+        _warmupCache = std::make_shared<WarmupCache>(_cfg.cache_dir, key.str());
+    }
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -139,6 +154,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    _compiledConstants.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -158,7 +174,8 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(new VariableState(state_name, state_store, memoryNode->getStateDesc(),
+                                                            _cfg.variableStateReserve));
             }
         }
     }
@@ -188,9 +205,20 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         _mutex,
+                                                         isQuantizedFlag,
+                                                         numaNodeId);
                 }
+                graphLock._graph.SetCompiledConstants(_compiledConstants);
                 graphLock._graph.CreateGraph(_network, ctx);
+                if (_warmupCache) {
+                    graphLock._graph.WarmUp(_warmupCache->getShapes());
+                }
+                std::lock_guard<std::mutex> lock{*_mutex.get()};
+                _graphContexts.push_back(ctx);
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -252,6 +280,32 @@ Parameter ExecNetwork::GetConfig(const std::string &name) const {
     return GetConfigLegacy(name);
 }
 
+std::set<MultiCacheCPtr> ExecNetwork::GetRuntimeCaches() const {
+    // the graphs aren't locked, the caches are read by the atomic counters only
+    std::lock_guard<std::mutex> lock{*_mutex.get()};
+    // the streams may share the cache of the reentrant values
+    std::set<MultiCacheCPtr> caches;
+    for (const auto& context : _graphContexts) {
+        const auto& cache = context->getParamsCache();
+        caches.insert(cache);
+        if (cache->getReentrantCache())
+            caches.insert(cache->getReentrantCache());
+    }
+    return caches;
+}
+
+std::map<MemoryCPtr, int> ExecNetwork::GetPackedWeights() const {
+    // the graphs aren't locked, the packed weights list of the context has its own guard
+    std::lock_guard<std::mutex> lock{*_mutex.get()};
+    // the streams on the same NUMA node share the weights
+    std::map<MemoryCPtr, int> weights;
+    for (const auto& context : _graphContexts) {
+        for (const auto& memory : context->getPackedWeightsList())
+            weights.emplace(memory, context->getNumaNodeId());
+    }
+    return weights;
+}
+
 InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name, const GraphGuard& graph) const {
     if (name == METRIC_KEY(NETWORK_NAME)) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, graph.dump()->get_friendly_name());
@@ -275,6 +329,33 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == ov::cpu_runtime_cache_statistics) {
+        uint64_t hits = 0, misses = 0, evictions = 0;
+        for (const auto& cache : GetRuntimeCaches()) {
+            const auto& statistics = cache->getStatistics();
+            hits += statistics.hits;
+            misses += statistics.misses;
+            evictions += statistics.evictions;
+        }
+        return decltype(ov::cpu_runtime_cache_statistics)::value_type{
+            {"hits", hits}, {"misses", misses}, {"evictions", evictions}};
+    } else if (name == ov::cpu_runtime_cache_bytes) {
+        uint64_t bytes = 0;
+        for (const auto& cache : GetRuntimeCaches())
+            bytes += cache->getBytes();
+        return decltype(ov::cpu_runtime_cache_bytes)::value_type{bytes};
+    } else if (name == ov::cpu_numa_weights_bytes) {
+        std::map<int, uint64_t> nodesBytes;
+        for (const auto& weights : GetPackedWeights()) {
+            const auto& memory = weights.first;
+            // the placement is known on Linux only, otherwise the weights are counted on the node of their graph
+            if (!getNumaNodesBytes(memory->GetData(), memory->GetSize(), nodesBytes))
+                nodesBytes[weights.second] += memory->GetSize();
+        }
+        decltype(ov::cpu_numa_weights_bytes)::value_type bytes;
+        for (const auto& node : nodesBytes)
+            bytes[std::to_string(node.first)] = node.second;
+        return bytes;
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -544,6 +625,8 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+    // the constants are the same in all the graphs
+    CompiledConstants::write(modelStream, GetGraph()._graph.GetCompiledConstants());
 }
 
 }   // namespace intel_cpu
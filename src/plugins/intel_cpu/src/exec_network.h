@@ -10,11 +10,13 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
+#include "cache/warmup_cache.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
+#include <set>
 #include <string>
 #include <unordered_map>
 
@@ -37,7 +39,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                CompiledConstants::CPtr compiledConstants = nullptr);
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -69,6 +72,13 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // input shapes of the dynamic model kept in the cache dir to generate the kernels when the graphs are created
+    WarmupCache::Ptr                            _warmupCache;
+    // constants of the imported network restored by the graphs instead of computing them, released once
+    // the graphs are created
+    CompiledConstants::CPtr                     _compiledConstants;
+    // contexts of the created graphs, read by the metrics without locking the graphs (guarded by _mutex)
+    mutable std::vector<GraphContext::CPtr>     _graphContexts;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -76,6 +86,12 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    // the runtime parameters caches of all the created graphs
+    std::set<MultiCacheCPtr> GetRuntimeCaches() const;
+
+    // the packed weights of all the created graphs with the NUMA node of the graph
+    std::map<MemoryCPtr, int> GetPackedWeights() const;
+
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
@@ -55,6 +55,8 @@
 #include <common/primitive_desc_iface.hpp>
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 #   include <tbb/task_group.h>
+#   include <tbb/task_arena.h>
+#   include <tbb/enumerable_thread_specific.h>
 #endif
 
 using namespace dnnl;
@@ -406,6 +408,14 @@ void Graph::InitGraph() {
         this->reuse_io_tensors = false;
     }
 
+    parallelBranches = CanExecuteBranchesInParallel(haveDynNodes);
+
+    shapePlanCache.enabled = haveDynNodes && CanCacheShapePlans();
+    // the tensors are placed in the arena according to the shape plans, so the arena is used only if the plans are
+    // valid for any input values (see CanCacheShapePlans)
+    if (shapePlanCache.enabled && getConfig().dynamicMemoryArena)
+        memoryArena = std::make_shared<MemoryArena>(getConfig().dynamicMemoryArenaShrink);
+
     Allocate();
 
     CreatePrimitives();
@@ -417,7 +427,11 @@ void Graph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    if (parallelBranches)
+        InitParallelBranches();
+
     ExecuteConstantNodesOnly();
+    compiledConstants.reset();
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -519,7 +533,51 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // restore the constants computed by the exported graph, the nodes whose outputs are all restored or consumed
+    // only by such nodes are not executed
+    std::unordered_set<const Node*> restoredNodes;
+    if (compiledConstants && compiledConstants->size()) {
+        std::unordered_set<const Edge*> restoredEdges;
+        for (const auto &node : constantGraphNodes) {
+            for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+                auto edgePtr = node->getChildEdgeAt(i);
+                if (!IsCompiledConstant(edgePtr))
+                    continue;
+                const auto& memory = edgePtr->getMemory();
+                auto load = [&]() {
+                    return compiledConstants->load(edgePtr->name(), memory.getDesc(), memory.GetData(), memory.GetSize());
+                };
+                if (edgePtr->isUseExternalMemory()) {
+                    // the output shared between the streams may be already restored by another stream
+                    auto sharedOutput = context->getWeightsCache()->get(edgePtr->name());
+                    if (!sharedOutput->isValid()) {
+                        if (!load())
+                            continue;
+                        sharedOutput->valid(true);
+                    }
+                } else if (!load()) {
+                    continue;
+                }
+                restoredEdges.insert(edgePtr.get());
+            }
+        }
+        for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+            const auto& node = *it;
+            bool restored = !node->getChildEdges().empty();
+            for (size_t i = 0; i < node->getChildEdges().size() && restored; ++i) {
+                auto edgePtr = node->getChildEdgeAt(i);
+                restored = restoredEdges.count(edgePtr.get()) || restoredNodes.count(edgePtr->getChild().get());
+            }
+            if (restored)
+                restoredNodes.insert(node.get());
+        }
+        DEBUG_LOG("Restored ", restoredEdges.size(), " compiled constants, skipped ", restoredNodes.size(),
+                  " constant nodes of ", constantGraphNodes.size());
+    }
+
     for (const auto &node : constantGraphNodes) {
+        if (restoredNodes.count(node.get()))
+            continue;
         if (context->getWeightsCache()) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
@@ -535,6 +593,26 @@ void Graph::ExecuteConstantNodesOnly() const {
     }
 }
 
+bool Graph::IsCompiledConstant(const EdgePtr& edge) {
+    const auto parent = edge->getParent();
+    // the constant inputs are a part of the model weights, the in-place edges share the memory with other edges
+    return parent->isConstant() && parent->getType() != Type::Input && !edge->getChild()->isConstant() &&
+           !edge->inPlace() && edge->getMemoryPtr() && edge->getMemoryPtr()->isAllocated() &&
+           CompiledConstants::isSupported(edge->getMemory().getDesc());
+}
+
+std::vector<CompiledConstants::NamedMemory> Graph::GetCompiledConstants() const {
+    std::vector<CompiledConstants::NamedMemory> constants;
+    for (const auto &node : constantGraphNodes) {
+        for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+            auto edgePtr = node->getChildEdgeAt(i);
+            if (IsCompiledConstant(edgePtr))
+                constants.emplace_back(edgePtr->name(), edgePtr->getMemoryPtr());
+        }
+    }
+    return constants;
+}
+
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const dnnl::engine& eng) {
     auto definedParentDesc = parentDesc->isDefined() ? parentDesc : MemoryDescUtils::makeDummyDesc(*parentDesc);
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(definedParentDesc)->getDnnlDesc();
@@ -747,6 +825,13 @@ void Graph::AllocateWithReuse() {
             }
         }
 
+        // The lifetimes above are based on the sequential execution order. Independent branches executed
+        // concurrently may touch tensors with non-overlapping intervals at the same time, so disable reuse.
+        if (parallelBranches) {
+            box.start = 0;
+            box.finish = -1;
+        }
+
         if (boxSize != -1) {
             box.size = div_up(boxSize, alignment);
             definedBoxes.push_back(box);
@@ -788,6 +873,30 @@ void Graph::AllocateWithReuse() {
         IE_ASSERT(count == 1);
     }
 
+    // the intermediate tensors are placed in the arena at the offsets planned for the actual shapes, the graph
+    // inputs and outputs live during the whole inference and keep their own memory
+    if (memoryArena) {
+        auto isIntermediate = [](const MemorySolver::Box& box) {
+            return box.finish != -1;
+        };
+        for (const auto& box : undefinedBoxes) {
+            if (!isIntermediate(box))
+                continue;
+            const auto& cluster = edge_clusters[box.id];
+            auto memMngr =
+                memoryArena->addTensor(box.start, box.finish, std::vector<EdgePtr>(cluster.begin(), cluster.end()));
+            for (auto& edge : cluster) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    edge->allocate(memMngr);
+                }
+            }
+        }
+        undefinedBoxes.erase(std::remove_if(undefinedBoxes.begin(), undefinedBoxes.end(), isIntermediate),
+                             undefinedBoxes.end());
+        if (memoryArena->empty())
+            memoryArena.reset();
+    }
+
     if (!undefinedBoxes.empty()) {
         if (!syncNodesInds.empty()) {
             //We have to extend the lifespan of thensors that are crossing a sync point border in order to save
@@ -872,6 +981,113 @@ void Graph::Allocate() {
     for (auto& edge : graphEdges) edge->validate();
 }
 
+bool Graph::CanExecuteBranchesInParallel(bool haveDynNodes) const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!getConfig().parallelBranches || haveDynNodes)
+        return false;
+
+    // MemoryInput/MemoryOutput pairs communicate through the state storage, which is not represented by edges
+    for (const auto& node : graphNodes) {
+        if (one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput))
+            return false;
+    }
+
+    // nothing to gain on a chain of nodes, so check there are at least two nodes on the same topological level
+    std::unordered_map<const Node*, size_t> levels;
+    std::unordered_map<size_t, size_t> levelWidths;
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        size_t level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto itr = levels.find(node->getParentEdgeAt(i)->getParent().get());
+            if (itr != levels.end())
+                level = std::max(level, itr->second + 1);
+        }
+        levels[node.get()] = level;
+        if (one_of(node->getType(), Type::Input, Type::Output))
+            continue;
+        if (++levelWidths[level] > 1)
+            return true;
+    }
+    return false;
+#else
+    return false;
+#endif
+}
+
+void Graph::InitParallelBranches() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitParallelBranches");
+
+    const size_t nodesNum = executableGraphNodes.size();
+    std::unordered_map<const Node*, size_t> execNodesInds;
+    for (size_t i = 0; i < nodesNum; ++i)
+        execNodesInds[executableGraphNodes[i].get()] = i;
+
+    // executableGraphNodes are sorted topologically, so the dependencies always point to the nodes with greater index
+    std::vector<std::unordered_set<size_t>> successors(nodesNum);
+
+    // data dependencies, non executable nodes (e.g. optimized out Reshape) are looked through
+    for (size_t i = 0; i < nodesNum; ++i) {
+        std::vector<NodePtr> toVisit = {executableGraphNodes[i]};
+        std::unordered_set<const Node*> visited;
+        while (!toVisit.empty()) {
+            const auto node = toVisit.back();
+            toVisit.pop_back();
+            for (size_t j = 0; j < node->getChildEdges().size(); j++) {
+                const auto child = node->getChildEdgeAt(j)->getChild();
+                if (!visited.insert(child.get()).second)
+                    continue;
+                const auto itr = execNodesInds.find(child.get());
+                if (itr != execNodesInds.end()) {
+                    successors[i].insert(itr->second);
+                } else {
+                    toVisit.push_back(child);
+                }
+            }
+        }
+    }
+
+    // write after read dependencies: a node may write to the memory shared (in-place) with inputs of other nodes,
+    // e.g. Convolution with in-place sum. The sequential order guarantees such readers are executed before the writer
+    // (see Edge::enforceReorder), so the order must be preserved explicitly
+    for (const auto& cluster : findEdgeClusters(graphEdges)) {
+        std::vector<size_t> writers, readers;
+        for (const auto& edge : cluster) {
+            const auto parent = execNodesInds.find(edge->getParent().get());
+            if (parent != execNodesInds.end())
+                writers.push_back(parent->second);
+            const auto child = execNodesInds.find(edge->getChild().get());
+            if (child != execNodesInds.end())
+                readers.push_back(child->second);
+        }
+        for (auto writer : writers) {
+            for (auto reader : readers) {
+                if (reader < writer)
+                    successors[reader].insert(writer);
+            }
+        }
+    }
+
+    execNodesSuccessors.assign(nodesNum, {});
+    execNodesDepsNum.assign(nodesNum, 0);
+    std::vector<size_t> levels(nodesNum, 0);
+    std::vector<size_t> levelWidths(nodesNum, 0);
+    for (size_t i = 0; i < nodesNum; ++i) {
+        auto& nodeSuccessors = execNodesSuccessors[i];
+        nodeSuccessors.assign(successors[i].begin(), successors[i].end());
+        std::sort(nodeSuccessors.begin(), nodeSuccessors.end());
+        for (auto successor : nodeSuccessors) {
+            execNodesDepsNum[successor]++;
+            levels[successor] = std::max(levels[successor], levels[i] + 1);
+        }
+        levelWidths[levels[i]]++;
+    }
+    branchesMaxWidth = nodesNum ? *std::max_element(levelWidths.begin(), levelWidths.end()) : 0;
+
+    DEBUG_LOG("Parallel branches: ", nodesNum, " executable nodes, max width ", branchesMaxWidth);
+}
+
 void Graph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::CreatePrimitives");
     for (auto& node : graphNodes) {
@@ -1051,9 +1267,161 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferStaticParallel(InferRequestBase* request) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const bool collectPerfCounters = getConfig().collectPerfCounters;
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::atomic<size_t>> depsCounters(executableGraphNodes.size());
+    for (size_t i = 0; i < depsCounters.size(); ++i) {
+        depsCounters[i].store(execNodesDepsNum[i], std::memory_order_relaxed);
+    }
+
+    std::atomic<size_t> activeNodes(0);
+    std::atomic<size_t> peakConcurrency(0);
+    std::atomic<uint64_t> busyTime(0);
+
+    tbb::enumerable_thread_specific<dnnl::stream> streams([this] { return dnnl::stream(getEngine()); });
+    tbb::task_group tg;
+    std::function<void(size_t)> runBranch;
+
+    // Executes the node and goes on with one of its ready successors in the same task, so a chain of nodes
+    // doesn't pay for spawning. The rest of the ready successors are spawned as separate tasks.
+    runBranch = [&](size_t nodeIdx) {
+        while (true) {
+            const auto& node = executableGraphNodes[nodeIdx];
+            if (collectPerfCounters) {
+                const auto active = ++activeNodes;
+                auto peak = peakConcurrency.load();
+                while (active > peak && !peakConcurrency.compare_exchange_weak(peak, active)) {}
+            }
+            {
+                VERBOSE(node, getConfig().debugCaps.verbose);
+                PERF(node, collectPerfCounters);
+
+                if (request)
+                    request->ThrowIfCanceled();
+                auto& stream = streams.local();
+                // Isolation prevents the thread, which waits for the node's own parallel loops, from picking up
+                // the task of another branch and delaying the current one
+                tbb::this_task_arena::isolate([&] { ExecuteNode(node, stream); });
+            }
+            if (collectPerfCounters) {
+                busyTime += std::chrono::duration_cast<std::chrono::microseconds>(node->PerfCounter().duration()).count();
+                --activeNodes;
+            }
+
+            bool hasNext = false;
+            size_t nextIdx = 0;
+            for (auto successor : execNodesSuccessors[nodeIdx]) {
+                if (--depsCounters[successor] != 0)
+                    continue;
+                if (hasNext) {
+                    tg.run([&runBranch, successor] { runBranch(successor); });
+                } else {
+                    nextIdx = successor;
+                    hasNext = true;
+                }
+            }
+            if (!hasNext)
+                return;
+            nodeIdx = nextIdx;
+        }
+    };
+
+    for (size_t i = 0; i < execNodesDepsNum.size(); ++i) {
+        if (execNodesDepsNum[i] == 0)
+            tg.run([&runBranch, i] { runBranch(i); });
+    }
+    tg.wait();
+
+    if (collectPerfCounters) {
+        const auto wallTime = std::chrono::high_resolution_clock::now() - startTime;
+        parallelBranchesStats.peakConcurrency = std::max(parallelBranchesStats.peakConcurrency, peakConcurrency.load());
+        parallelBranchesStats.wallTime += std::chrono::duration_cast<std::chrono::microseconds>(wallTime).count();
+        parallelBranchesStats.busyTime += busyTime.load();
+        parallelBranchesStats.num++;
+    }
+#else
+    InferStatic(request);
+#endif
+}
+
+bool Graph::CanCacheShapePlans() const {
+    // the plans are keyed on the input dims only, so no output shape may depend on the input values: e.g. Reshape,
+    // Broadcast or Range with the target computed from a Parameter, or the nodes with the internal dynamism
+    const bool dataDependent = std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->outputShapeDataDependency();
+    });
+    if (dataDependent || !syncNodesInds.empty())
+        return false;
+    // the shapes of the memory inputs are defined by the states
+    return std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->getType() == Type::MemoryInput;
+    });
+}
+
+Graph::ShapePlanCache::Entry* Graph::FindShapePlan(const std::vector<VectorDims>& inputDims) {
+    auto& plans = shapePlanCache.plans;
+    for (auto it = plans.begin(); it != plans.end(); ++it) {
+        if (it->inputDims == inputDims) {
+            plans.splice(plans.begin(), plans, it);
+            shapePlanCache.hits++;
+            return &plans.front();
+        }
+    }
+    shapePlanCache.misses++;
+    return nullptr;
+}
+
+Graph::ShapePlanCache::Entry* Graph::StoreShapePlan(std::vector<VectorDims> inputDims) {
+    std::vector<std::vector<VectorDims>> plan(executableGraphNodes.size());
+    for (size_t i = 0; i < executableGraphNodes.size(); ++i) {
+        const auto& node = executableGraphNodes[i];
+        if (!node->isDynamicNode())
+            continue;
+        plan[i].reserve(node->outputShapes.size());
+        for (size_t port = 0; port < node->outputShapes.size(); ++port) {
+            const auto edges = node->getChildEdgesAtPort(port);
+            if (edges.empty())
+                return nullptr;
+            const auto& shape = edges[0]->getMemory().getDesc().getShape();
+            if (!shape.isStatic())
+                return nullptr;
+            plan[i].push_back(shape.getStaticDims());
+        }
+    }
+
+    auto& plans = shapePlanCache.plans;
+    if (plans.size() >= ShapePlanCache::capacity)
+        plans.pop_back();
+    plans.push_front({std::move(inputDims), std::move(plan), nullptr});
+    return &plans.front();
+}
+
 void Graph::InferDynamic(InferRequestBase* request) {
     dnnl::stream stream(getEngine());
 
+    // the shape inference is skipped if the same input dims were inferred before
+    std::vector<VectorDims> inputDims;
+    ShapePlanCache::Entry* shapePlan = nullptr;
+    if (shapePlanCache.enabled) {
+        inputDims = GetInputDims();
+        shapePlan = FindShapePlan(inputDims);
+    }
+    // the tensors are placed before the shape inference, so they aren't reallocated on the redefinition
+    if (memoryArena && shapePlan && shapePlan->memoryPlan)
+        memoryArena->apply(shapePlan->memoryPlan);
+
+    const auto* cachedDims = shapePlan ? &shapePlan->outputDims : nullptr;
+    const auto inferNodeShapes = [cachedDims](const NodePtr& node, size_t nodeIndx) {
+        if (!cachedDims) {
+            node->updateShapes();
+        } else if (node->needShapeInfer()) {
+            node->redefineOutputMemory((*cachedDims)[nodeIndx]);
+        }
+    };
+
     std::set<size_t> syncIndsWorkSet;
     for (const auto& nodeIndx : syncNodesInds) {
         syncIndsWorkSet.insert(nodeIndx.second);
@@ -1084,7 +1452,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
             return;
         }
         if (node->isDynamicNode()) {
-            node->updateShapes();
+            inferNodeShapes(node, node_indx);
         }
         if (--waveFrontCount[node_indx] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx, stop_indx); });
@@ -1117,7 +1485,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                inferNodeShapes(node, prepareCounter);
                 node->updateDynamicParams();
             }
         }
@@ -1127,6 +1495,15 @@ void Graph::InferDynamic(InferRequestBase* request) {
 
     for (auto stopIndx : syncIndsWorkSet) {
         updateNodes(stopIndx);
+        // there are no synchronization nodes if the plans are cached, so all the nodes are updated at once
+        if (shapePlanCache.enabled && !shapePlan)
+            shapePlan = StoreShapePlan(std::move(inputDims));
+        // no node is executed yet, so the intermediate tensors can be moved to the planned offsets
+        if (memoryArena && shapePlan) {
+            if (!shapePlan->memoryPlan)
+                shapePlan->memoryPlan = memoryArena->makePlan();
+            memoryArena->apply(shapePlan->memoryPlan);
+        }
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, getConfig().debugCaps.verbose);
@@ -1152,6 +1529,81 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     DEBUG_LOG(*node);
 }
 
+std::vector<VectorDims> Graph::GetInputDims() const {
+    std::vector<VectorDims> inputDims;
+    inputDims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto edges = input.second->getChildEdgesAtPort(0);
+        // unused inputs are not allocated
+        inputDims.push_back(edges.empty() ? VectorDims{} : edges[0]->getMemory().getStaticDims());
+    }
+    return inputDims;
+}
+
+void Graph::WarmUp(const std::vector<std::vector<VectorDims>>& inputShapes) {
+    if (Status::ReadyDynamic != status)
+        return;
+
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::WarmUp");
+
+    // the output shapes of the synchronization nodes are known after the execution only, the shape inference of
+    // the nodes depending on the input values reads the memory, which isn't filled before the execution
+    size_t stopIndx = executableGraphNodes.size();
+    for (const auto& nodeIndx : syncNodesInds) {
+        stopIndx = std::min(stopIndx, nodeIndx.second);
+    }
+    for (size_t i = 0; i < stopIndx; ++i) {
+        if (executableGraphNodes[i]->outputShapeDataDependency()) {
+            stopIndx = i;
+            break;
+        }
+    }
+
+    for (const auto& shapes : inputShapes) {
+        if (shapes.size() != inputNodesMap.size())
+            continue;
+        NodePtr node;
+        try {
+            auto shape = shapes.begin();
+            for (const auto& input : inputNodesMap) {
+                const auto& inputNode = input.second;
+                if (inputNode->isDynamicNode() && !inputNode->getChildEdgesAtPort(0).empty()) {
+                    if (!inputNode->getOutputShapeAtPort(0).isCompatible(*shape))
+                        IE_THROW() << "incompatible shape of the input " << input.first;
+                    inputNode->redefineOutputMemory({*shape});
+                }
+                ++shape;
+            }
+            // the last input dims are updated as if the nodes were executed, so the next inference prepares
+            // the nodes only if its shapes differ
+            for (size_t i = 0; i < stopIndx; ++i) {
+                node = executableGraphNodes[i];
+                if (node->isDynamicNode()) {
+                    node->updateShapes();
+                    node->updateDynamicParams();
+                    node->updateLastInputDims();
+                }
+            }
+            if (shapePlanCache.enabled) {
+                auto inputDims = GetInputDims();
+                const auto& plans = shapePlanCache.plans;
+                const bool stored = std::any_of(plans.begin(), plans.end(), [&inputDims](const ShapePlanCache::Entry& plan) {
+                    return plan.inputDims == inputDims;
+                });
+                if (!stored)
+                    StoreShapePlan(std::move(inputDims));
+            }
+        } catch (...) {
+            // the warm up is an optimization only, the inference prepares the nodes anyway,
+            // the failed node may have redefined its outputs, so it must be prepared again
+            if (node) {
+                node->lastInputDims.clear();
+                DEBUG_LOG("Graph ", GetName(), " warm up failed on the node ", node->getName());
+            }
+        }
+    }
+}
+
 void Graph::Infer(InferRequestBase* request) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
@@ -1160,7 +1612,11 @@ void Graph::Infer(InferRequestBase* request) {
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        if (parallelBranches) {
+            InferStaticParallel(request);
+        } else {
+            InferStatic(request);
+        }
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
@@ -1284,6 +1740,31 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
             continue;
         getPerfMapFor(perfMap, graphNodes[i]);
     }
+
+    // Summary of the parallel branches execution: realTime is the wall time of the whole inference and cpuTime
+    // is the total nodes execution time, so their ratio is the average achieved concurrency
+    if (parallelBranches && parallelBranchesStats.num > 0) {
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["ParallelBranches"];
+        pc.execution_index = i++;
+        pc.realTime_uSec = static_cast<long long>(parallelBranchesStats.wallTime / parallelBranchesStats.num);
+        pc.cpu_uSec = static_cast<long long>(parallelBranchesStats.busyTime / parallelBranchesStats.num);
+        pc.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+        const std::string execType = "width_" + std::to_string(branchesMaxWidth) +
+                                     "_peak_" + std::to_string(parallelBranchesStats.peakConcurrency);
+        execType.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        std::string("ParallelBranches").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    }
+
+    // Hit rate of the shape plans cache of the dynamic graph
+    if (shapePlanCache.enabled && shapePlanCache.hits + shapePlanCache.misses > 0) {
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["ShapePlanCache"];
+        pc.execution_index = i++;
+        pc.status = InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        const std::string execType = "hits_" + std::to_string(shapePlanCache.hits) +
+                                     "_misses_" + std::to_string(shapePlanCache.misses);
+        execType.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        std::string("ShapePlanCache").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    }
 }
 
 void Graph::RemoveEdge(EdgePtr& edge) {
@@ -11,8 +11,11 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "compiled_constants.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "memory_arena.h"
+#include <list>
 #include <map>
 #include <string>
 #include <vector>
@@ -190,6 +193,33 @@ public:
         return graphHasDynamicInput;
     }
 
+    /**
+     * @brief Returns the current dims of the graph inputs in the order of the input nodes map
+     */
+    std::vector<VectorDims> GetInputDims() const;
+
+    /**
+     * @brief Runs the shape inference and prepares the dynamic nodes for each set of the input shapes without the
+     * execution, so the kernels for these shapes are generated (and stored in the runtime cache) ahead of the first
+     * inference. The preparation stops at the first node whose output shapes depend on the input data.
+     * @param inputShapes sets of the graph input shapes in the order of the input nodes map
+     */
+    void WarmUp(const std::vector<std::vector<VectorDims>>& inputShapes);
+
+    /**
+     * @brief Returns the constants computed by the graph and consumed by the non-constant nodes, e.g. the weights
+     * reordered to the layouts of the selected primitives, with the names of the edges passing them
+     */
+    std::vector<CompiledConstants::NamedMemory> GetCompiledConstants() const;
+
+    /**
+     * @brief Sets the constants computed by the exported graph. The next graph creation restores the matching
+     * constants and skips the execution of the constant nodes which compute only them.
+     */
+    void SetCompiledConstants(CompiledConstants::CPtr constants) {
+        compiledConstants = std::move(constants);
+    }
+
 protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
@@ -202,6 +232,13 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        parallelBranches = false;
+        execNodesSuccessors.clear();
+        execNodesDepsNum.clear();
+        branchesMaxWidth = 0;
+        parallelBranchesStats = {};
+        shapePlanCache = {};
+        memoryArena.reset();
     }
     Status status { Status::NotReady };
 
@@ -235,7 +272,11 @@ protected:
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
     void InferStatic(InferRequestBase* request);
+    void InferStaticParallel(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
+    bool CanExecuteBranchesInParallel(bool haveDynNodes) const;
+    void InitParallelBranches();
+    bool CanCacheShapePlans() const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -255,9 +296,48 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // Dependency DAG over executableGraphNodes used by the parallel branches execution mode.
+    // Both vectors are indexed by the position of the node in executableGraphNodes.
+    bool parallelBranches = false;
+    std::vector<std::vector<size_t>> execNodesSuccessors;
+    std::vector<size_t> execNodesDepsNum;
+    size_t branchesMaxWidth = 0;  // max number of nodes that may be executed concurrently (widest DAG level)
+
+    // achieved concurrency statistics, collected only when perf counters are enabled
+    struct ParallelBranchesStats {
+        size_t peakConcurrency = 0;
+        uint64_t wallTime = 0;  // microseconds, accumulated over all inferences
+        uint64_t busyTime = 0;  // microseconds, accumulated nodes execution time over all inferences
+        uint32_t num = 0;
+    } parallelBranchesStats;
+
+    // Output dims of the dynamic executable nodes per the graph input dims, so the inference with the repeated input
+    // shapes redefines the outputs of the nodes without the shape inference. Used only when the input dims define
+    // the dims of all the nodes, i.e. there are neither data nor state dependent shapes in the graph.
+    struct ShapePlanCache {
+        struct Entry {
+            std::vector<VectorDims> inputDims;
+            std::vector<std::vector<VectorDims>> outputDims;  // indexed by the position in executableGraphNodes
+            MemoryArena::PlanPtr memoryPlan;  // the offsets of the tensors in the memory arena, if it is used
+        };
+        static constexpr size_t capacity = 32;
+        bool enabled = false;
+        std::list<Entry> plans;  // the most recently used first
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    } shapePlanCache;
+
+    ShapePlanCache::Entry* FindShapePlan(const std::vector<VectorDims>& inputDims);
+    ShapePlanCache::Entry* StoreShapePlan(std::vector<VectorDims> inputDims);
+
+    // the intermediate tensors with undefined sizes placed according to the shape plans (see Config::dynamicMemoryArena)
+    std::shared_ptr<MemoryArena> memoryArena;
+
     GraphContext::CPtr context;
+    CompiledConstants::CPtr compiledConstants;  // released once the constant nodes are executed
 
     void EnforceBF16();
+    static bool IsCompiledConstant(const EdgePtr& edge);
 };
 
 }   // namespace intel_cpu
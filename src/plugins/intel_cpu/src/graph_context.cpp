@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include <dnnl_types.h>
+#include <ie_system_conf.h>
 #include "graph_context.h"
 
 namespace ov {
@@ -9,5 +10,47 @@ namespace intel_cpu {
 
 dnnl::engine GraphContext::eng(dnnl::engine::kind::cpu, 0);
 
+MemoryPtr GraphContext::getPackedWeights(const void* srcData, size_t srcSize, const MemoryDesc& srcDesc,
+                                         const MemoryDesc& packedDesc,
+                                         const std::function<void(Memory&)>& pack) const {
+    static const bool multiSocket = InferenceEngine::getAvailableNUMANodes().size() > 1;
+    auto createLocal = [&] () {
+        // The graphs are created by the threads of their streams, so the packed weights are usually first touched on
+        // the right NUMA node. The pages touched by the other threads (e.g. the ones of the parallel reorder outside
+        // of the stream arena) may land on any node, so the weights are packed straight to the memory bound to the node.
+        // The small weights stay on the heap, each bound buffer is a separate mapping.
+        constexpr size_t minBoundSize = 64 * 1024;
+        const bool bound = multiSocket && config.numaWeightsBinding && packedDesc.getCurrentMemSize() >= minBoundSize;
+        auto memory = bound ? std::make_shared<Memory>(getEngine(),
+                                                       std::unique_ptr<IMemoryMngr>(new MemoryMngrOnNumaNode(numaNodeId)))
+                            : std::make_shared<Memory>(getEngine());
+        memory->Create(packedDesc);
+        pack(*memory);
+        return memory;
+    };
+
+    MemoryPtr memory;
+    if (config.packedWeightsShared) {
+        const auto key = PackedWeightsStore::makeKey(srcData, srcSize, srcDesc, packedDesc, numaNodeId);
+        memory = PackedWeightsStore::getInstance().findOrCreate(key, createLocal);
+    } else {
+        memory = createLocal();
+    }
+
+    std::lock_guard<std::mutex> lock(packedWeightsGuard);
+    packedWeights.emplace_back(memory);
+    return memory;
+}
+
+std::vector<MemoryCPtr> GraphContext::getPackedWeightsList() const {
+    std::vector<MemoryCPtr> list;
+    std::lock_guard<std::mutex> lock(packedWeightsGuard);
+    for (const auto& weights : packedWeights) {
+        if (auto memory = weights.lock())
+            list.emplace_back(memory);
+    }
+    return list;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -22,14 +22,20 @@ public:
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
                  std::shared_ptr<std::mutex> sharedMutex,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 int numaNodeId = 0)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
           sharedMutex(sharedMutex),
-          isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
-        rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+          isGraphQuantizedFlag(isGraphQuantized),
+          numaNodeId(numaNodeId) {
+        // the streams share only the reentrant primitives, the executors with the state are cached per stream,
+        // or aren't cached at all if the nodes of the graph may be executed concurrently (parallel branches)
+        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity, false, config.rtCacheBudget,
+                                                     config.rtCacheShared ? MultiCache::getSharedInstance(config.rtCacheCapacity) : nullptr,
+                                                     !config.parallelBranches);
+        rtScratchPad = std::make_shared<DnnlScratchPad>(eng, !config.parallelBranches);
     }
 
     const Config& getConfig() const {
@@ -64,6 +70,19 @@ public:
         return isGraphQuantizedFlag;
     }
 
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    // returns the packed weights with the same content shared by the compiled models if it is enabled,
+    // otherwise allocates the memory of packedDesc and fills it by pack. On the multi-socket machines the memory
+    // is allocated on the NUMA node of the graph (CPU_NUMA_WEIGHTS_BINDING).
+    MemoryPtr getPackedWeights(const void* srcData, size_t srcSize, const MemoryDesc& srcDesc,
+                               const MemoryDesc& packedDesc, const std::function<void(Memory&)>& pack) const;
+
+    // the packed weights used by the graph
+    std::vector<MemoryCPtr> getPackedWeightsList() const;
+
 private:
     Config config;  // network-level config
 
@@ -75,6 +94,10 @@ private:
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
     bool isGraphQuantizedFlag = false;
+    int numaNodeId = 0;              // NUMA node of the streams executing the graph
+
+    mutable std::mutex packedWeightsGuard;
+    mutable std::vector<std::weak_ptr<Memory>> packedWeights;
     static dnnl::engine eng;  // onednn engine (singleton)
 };
 
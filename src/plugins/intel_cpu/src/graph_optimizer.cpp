@@ -20,6 +20,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/embedding_bag_sum.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -61,7 +62,10 @@ namespace intel_cpu {
 GraphOptimizer::GraphOptimizer() {}
 
 void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "QuantizeEmbeddingTables");
+    QuantizeEmbeddingTables(graph);
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -2221,5 +2225,30 @@ void GraphOptimizer::reshapeRnnSeq(Graph &graph) {
     }
 }
 
+void GraphOptimizer::QuantizeEmbeddingTables(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // the table is quantized before its constant is copied, the copy isn't made at all if the table is used by the
+    // quantized embedding bags only, as its data is read only here
+    for (const auto& node : graphNodes) {
+        auto embeddingBag = std::dynamic_pointer_cast<EmbeddingBagSum>(node);
+        if (!embeddingBag || !embeddingBag->isTableQuantized())
+            continue;
+        auto table = std::dynamic_pointer_cast<node::Input>(node->getParentEdgeAt(0)->getParent());
+        if (!table || !table->isConstant())
+            continue;
+
+        const auto& tableEdges = table->getChildEdges();
+        const bool readOnlyHere = std::all_of(tableEdges.begin(), tableEdges.end(), [](const EdgeWeakPtr& weakEdge) {
+            const auto edge = weakEdge.lock();
+            const auto child = edge ? std::dynamic_pointer_cast<EmbeddingBagSum>(edge->getChild()) : nullptr;
+            return child && child->isTableQuantized() && edge->getOutputNum() == 0;
+        });
+        if (readOnlyHere)
+            table->withSharedConstData();
+        embeddingBag->quantizeTable(table->getMemoryPtr(), graph.getGraphContext()->getWeightsCache());
+    }
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
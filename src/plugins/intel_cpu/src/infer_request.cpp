@@ -56,7 +56,8 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(new VariableState(state_name, state_store, memoryNode->getStateDesc(),
+                                                        execNetwork->_cfg.variableStateReserve));
         }
     }
 }
@@ -92,6 +93,107 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
+    edge->getMemoryPtr()->setDataHandle(newPtr);
+}
+
+// the memory of the input node edges may be replaced by the external one: the consumers don't share it with other edges
+static bool canChangeInputPtr(const NodePtr& inputNodePtr) {
+    auto& childEdges = inputNodePtr->getChildEdges();
+    // Input cannot be in-place with other primitives
+    bool canBeInPlace = true;
+    for (auto& childEdge : childEdges) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+
+        if (child->isConstant()) {
+            canBeInPlace = false;
+            break;
+        }
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<node::Concat*>(child.get());
+            if (concat && concat->isOptimized()) {
+                canBeInPlace = false;
+                break;
+            }
+        }
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Type::Split) {
+            canBeInPlace = false;
+            break;
+        }
+
+        if (child->isInPlace()) {
+            canBeInPlace = false;
+            break;
+        }
+
+        auto& edges = child->getChildEdges();
+        for (auto& edge : edges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData()) {
+                canBeInPlace = false;
+                break;
+            }
+        }
+
+        if (!canBeInPlace)
+            break;
+    }
+    return canBeInPlace;
+}
+
+// the memory of the edge may be replaced by the external one: the producers write only to it
+static bool canChangeOutputPtr(const EdgePtr& parentEdge) {
+    bool canBeInPlace = true;
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
+            canBeInPlace = false;
+            break;
+        }
+
+        auto& parentEdges = parent->getParentEdges();
+        for (auto& edge : parentEdges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return canBeInPlace;
+}
+
+// the edge is detached from the memory manager of the graph, so the manager must not be shared with the producer inputs
+// computed in place
+static bool canLendStateBuffer(const EdgePtr& parentEdge) {
+    if (!canChangeOutputPtr(parentEdge))
+        return false;
+    const auto& mngr = parentEdge->getMemory().getDnnlMemoryMngr();
+    for (auto& edge : parentEdge->getParent()->getParentEdges()) {
+        auto e = edge.lock();
+        if (!e || e->getMemory().getDnnlMemoryMngr() == mngr)
+            return false;
+    }
+    return true;
+}
+
 void InferRequestBase::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
@@ -102,16 +204,47 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast the state " << cur_id << " to VariableState";
+                    }
+                    // the graph is shared by the requests, so the state buffers are bound on every inference
+                    cur_node->setStateBuffers(cur_state->getCurrent(), cur_state->getNext(), canChangeInputPtr(node));
                 }
             }
         }
     }
+
+    // the producers of the new states write them to the next buffers directly
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
+            if (!cur_node) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
+            }
+            auto input_node = dynamic_cast<node::MemoryInput*>(cur_node->getInputNode());
+            if (!input_node || !input_node->getNextStore())
+                continue;
+            auto parentEdge = node->getParentEdgeAt(0);
+            if (node->isDynamicNode()) {
+                // the shape of the dynamic state is known only when it is computed, so the producer gets the memory
+                // manager of the next buffer and redefines it to the shape of the new state, the buffer grows
+                // geometrically. Otherwise the state is copied to the next buffer when it is stored.
+                const auto& memory = parentEdge->getMemoryPtr();
+                const auto& nextMngr = input_node->getNextStore()->getDnnlMemoryMngr();
+                if (memory->getDnnlMemoryMngr() != nextMngr && canLendStateBuffer(parentEdge))
+                    memory->Create(memory->getDescPtr(), nextMngr);
+                continue;
+            }
+            const auto nextData = input_node->getNextStore()->GetData();
+            // the new state may be computed in place of the current one
+            if (parentEdge->getMemory().GetData() == input_node->getStore()->GetData() ||
+                parentEdge->getMemory().GetData() == nextData)
+                continue;
+            if (canChangeOutputPtr(parentEdge))
+                changeEdgePtr(parentEdge, nextData);
+        }
+    }
 }
 
 void InferRequestBase::PullStates() {
@@ -121,15 +254,13 @@ void InferRequestBase::PullStates() {
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
+            if (!cur_node->isStateUpdated())
+                continue;
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    // the new state is in the next buffer, no copy is needed
+                    std::static_pointer_cast<VariableState>(state)->swapBuffers();
                 }
             }
         }
@@ -179,6 +310,15 @@ void InferRequestBase::InferImpl() {
 
     graph->Infer(this);
 
+    if (graph->hasDynamicInput() && execNetwork->_warmupCache) {
+        // the record is shared between the requests and may rewrite the file, so only the new shapes are passed
+        auto inputDims = graph->GetInputDims();
+        if (inputDims != lastRecordedDims) {
+            execNetwork->_warmupCache->record(inputDims);
+            lastRecordedDims = std::move(inputDims);
+        }
+    }
+
     if (memoryStates.size() != 0) {
         PullStates();
     }
@@ -196,10 +336,6 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestB
     return perfMap;
 }
 
-static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
-    edge->getMemoryPtr()->setDataHandle(newPtr);
-}
-
 void InferRequestBase::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         const auto& inputNodesMap = graph->GetInputNodesMap();
@@ -208,57 +344,8 @@ void InferRequestBase::changeDefaultPtr() {
             NodePtr inputNodePtr = input->second;
             if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetData() == it.second)
                 continue;
-            auto& childEdges = inputNodePtr->getChildEdges();
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (auto& childEdge : childEdges) {
-                auto ce = childEdge.lock();
-                if (!ce)
-                    IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                auto& child = ce->getChild();
-
-                if (child->isConstant()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->getType() == Type::Concatenation) {
-                    auto concat = dynamic_cast<node::Concat*>(child.get());
-                    if (concat && concat->isOptimized()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                if (child->getType() == Type::Split) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& edges = child->getChildEdges();
-                for (auto& edge : edges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << child->getName() << " contains empty child edge";
-
-                    if (e->getMemory().GetData() == ce->getMemory().GetData()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                if (!canBeInPlace)
-                    break;
-            }
-            if (canBeInPlace) {
-                for (auto& edge : childEdges) {
+            if (canChangeInputPtr(inputNodePtr)) {
+                for (auto& edge : inputNodePtr->getChildEdges()) {
                     auto e = edge.lock();
                     if (!e)
                         IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
@@ -277,31 +364,7 @@ void InferRequestBase::changeDefaultPtr() {
             if (parentEdge->getMemory().GetData() == it.second)
                 continue;
 
-            bool canBeInPlace = true;
-            void* defaultPtr = parentEdge->getMemory().GetData();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = parentEdge->getParent();
-            NodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& parentEdges = parent->getParentEdges();
-                for (auto& edge : parentEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
-
-                    if (e->getMemory().GetData() == defaultPtr) {
-                        parent = e->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (canChangeOutputPtr(parentEdge))
                 changeEdgePtr(parentEdge, it.second);
             continue;
         }
@@ -67,6 +67,7 @@ private:
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+    std::vector<VectorDims>             lastRecordedDims;
 
 protected:
     virtual void changeDefaultPtr();
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_arena.h"
+
+#include "memory_solver.hpp"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// the cache line, the same as the alignment of the buffer
+constexpr size_t alignment = 64;
+}   // namespace
+
+DnnlMemoryMngrPtr MemoryArena::addTensor(int start, int finish, std::vector<EdgePtr> edges) {
+    auto mngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+    _tensors.push_back({start, finish, std::move(edges), mngr});
+    return mngr;
+}
+
+MemoryArena::PlanPtr MemoryArena::makePlan() const {
+    auto plan = std::make_shared<Plan>();
+    plan->sizes.resize(_tensors.size(), 0);
+    plan->offsets.resize(_tensors.size(), 0);
+
+    std::vector<MemorySolver::Box> boxes;
+    boxes.reserve(_tensors.size());
+    for (size_t i = 0; i < _tensors.size(); i++) {
+        auto& size = plan->sizes[i];
+        for (const auto& edge : _tensors[i].edges) {
+            const auto& desc = edge->getMemory().getDesc();
+            if (!desc.isDefined())
+                IE_THROW() << "Can't plan the memory arena for the undefined shape of the edge " << edge->name();
+            size = std::max(size, desc.getCurrentMemSize());
+        }
+        boxes.push_back({_tensors[i].start, _tensors[i].finish, static_cast<int64_t>(div_up(size, alignment)),
+                         static_cast<int64_t>(i)});
+    }
+    if (boxes.empty())
+        return plan;
+
+    MemorySolver solver(boxes);
+    plan->size = static_cast<size_t>(solver.solve()) * alignment;
+    for (size_t i = 0; i < _tensors.size(); i++) {
+        plan->offsets[i] = static_cast<size_t>(solver.getOffset(static_cast<int>(i))) * alignment;
+    }
+    return plan;
+}
+
+void MemoryArena::apply(const PlanPtr& plan) {
+    if (plan == _applied)
+        return;
+
+    // the tensors may point to the previous buffer until they are moved to the new one
+    std::unique_ptr<MemoryMngrWithReuse> previous;
+    if (!_buffer || plan->size > _capacity || (_shrink && plan->size < _capacity / 2)) {
+        previous = std::move(_buffer);
+        _buffer.reset(new MemoryMngrWithReuse());
+        _buffer->resize(plan->size);
+        _capacity = plan->size;
+    }
+
+    auto* data = static_cast<uint8_t*>(_buffer->getRawPtr());
+    for (size_t i = 0; i < _tensors.size(); i++) {
+        _tensors[i].mngr->setExtBuff(data + plan->offsets[i], plan->sizes[i]);
+    }
+    _applied = plan;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "edge.h"
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief The memory arena of the intermediate tensors with undefined sizes of a dynamic graph.
+ *
+ * Every tensor (a cluster of the edges sharing the memory) has its own memory manager, which the arena points to
+ * a part of the single buffer. Once the shapes of an inference are known, the offsets of the tensors are assigned by
+ * MemorySolver according to their actual sizes and lifetimes, the same way as for the static shapes. The plan is
+ * supposed to be cached per the input shapes by the graph, so the solver runs once per input shapes.
+ * The data of the tensors isn't preserved when a plan is applied, so the plans are applied only between the
+ * inferences or before the execution of the first node.
+ */
+class MemoryArena {
+public:
+    struct Plan {
+        std::vector<size_t> offsets;  // bytes, per tensor
+        std::vector<size_t> sizes;    // bytes, per tensor
+        size_t size = 0;              // bytes, the whole arena
+    };
+    using PlanPtr = std::shared_ptr<const Plan>;
+
+    /**
+     * @param shrink allows to reallocate the buffer if the planned size is less than half of its capacity,
+     * otherwise the buffer only grows
+     */
+    explicit MemoryArena(bool shrink) : _shrink(shrink) {}
+
+    /**
+     * @brief Adds the tensor to the arena
+     * @param start the execution index of the first use of the tensor
+     * @param finish the execution index of the last use of the tensor
+     * @param edges the edges sharing the tensor memory
+     * @return the memory manager to allocate the edges with
+     */
+    DnnlMemoryMngrPtr addTensor(int start, int finish, std::vector<EdgePtr> edges);
+
+    bool empty() const noexcept {
+        return _tensors.empty();
+    }
+
+    /**
+     * @brief Plans the offsets of the tensors for their current sizes, all the shapes of the edges must be defined
+     */
+    PlanPtr makePlan() const;
+
+    /**
+     * @brief Places the tensors at the offsets of the plan, does nothing if the plan is already applied
+     */
+    void apply(const PlanPtr& plan);
+
+    size_t capacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    struct Tensor {
+        int start;
+        int finish;
+        std::vector<EdgePtr> edges;
+        DnnlMemoryMngrPtr mngr;
+    };
+
+    std::vector<Tensor> _tensors;
+    std::unique_ptr<MemoryMngrWithReuse> _buffer;
+    size_t _capacity = 0ul;
+    PlanPtr _applied;
+    bool _shrink = false;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
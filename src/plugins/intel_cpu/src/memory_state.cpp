@@ -11,10 +11,63 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage, MemoryDescPtr variableDesc, size_t reserve)
+    : InferenceEngine::IVariableStateInternal{name}, desc(std::move(variableDesc)) {
+    const bool isDynamic = !desc->isDefined();
+    for (size_t i = 0; i < buffers.size(); i++) {
+        if (isDynamic) {
+            buffers[i] = std::make_shared<Memory>(storage->getEngine(),
+                                                  std::unique_ptr<IMemoryMngr>(new MemoryMngrWithGrowth(reserve)));
+        } else {
+            buffers[i] = std::make_shared<Memory>(storage->getEngine());
+        }
+        buffers[i]->Create(storage->getDesc());
+    }
+    cpu_memcpy(buffers[current]->GetData(), storage->GetData(), storage->GetSize());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    const auto& buffer = getCurrent();
+    auto state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(buffer->getDesc()));
+    state->allocate();
+    cpu_memcpy(state->buffer(), buffer->GetData(), buffer->GetSize());
+    return state;
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    const auto& buffer = getCurrent();
+    // the dynamic state is reset to the smallest one, like the initial state of the variable
+    if (!desc->isDefined()) {
+        buffer->redefineDesc(desc->cloneWithNewDims(desc->getShape().getMinDims(), true));
+    }
+    // the smallest dynamic state may be empty, then the buffer isn't allocated
+    if (buffer->GetData() != nullptr && buffer->GetSize() != 0)
+        std::memset(buffer->GetData(), 0, buffer->GetSize());
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState) {
+        IE_THROW() << "Cannot set the state " << name << ": the new state is empty";
+    }
+    const auto& buffer = getCurrent();
+    const auto& dims = newState->getTensorDesc().getDims();
+    if (!desc->isDefined() && buffer->getStaticDims() != dims) {
+        if (!desc->getShape().isCompatible(dims)) {
+            IE_THROW() << "Cannot set the state " << name << ": the shape of the new state "
+                       << MemoryDescUtils::dims2str(dims) << " doesn't match the variable "
+                       << desc->getShape().toString();
+        }
+        buffer->redefineDesc(desc->cloneWithNewDims(dims, true));
+    }
+    if (newState->byteSize() != buffer->GetSize()) {
+        IE_THROW() << "Cannot set the state " << name << ": the size of the new state doesn't match the variable";
+    }
+    cpu_memcpy(buffer->GetData(), newState->cbuffer().as<const void*>(), buffer->GetSize());
+}
+
+void VariableState::swapBuffers() {
+    current ^= 1;
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -10,21 +10,51 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The variable state of the infer request kept in two buffers: the graph reads the current state from one
+ * buffer and writes the new state to the other one, then the buffers are swapped, so the inference doesn't copy the
+ * state. The buffers are reused by the next inferences, so GetState returns a copy of the current state.
+ *
+ * The shape of the variable may be dynamic, then the state shape changes from one inference to another. The buffers
+ * of such states grow geometrically from the reserved capacity, so a state growing by a few elements per inference
+ * (e.g. the KV cache of a sequence model) is reallocated only a logarithmic number of times.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    /**
+     * @param storage the initial state
+     * @param desc the descriptor of the variable, may be dynamic
+     * @param reserve the number of bytes reserved for each buffer of the variable with dynamic shape
+     */
+    VariableState(std::string name, MemoryPtr storage, MemoryDescPtr desc, size_t reserve = 0);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const MemoryPtr& getCurrent() const {
+        return buffers[current];
+    }
+
+    const MemoryPtr& getNext() const {
+        return buffers[current ^ 1];
+    }
+
+    /**
+     * @brief Makes the next buffer current once the new state has been stored to it
+     */
+    void swapBuffers();
+
+private:
+    MemoryDescPtr desc;
+    std::array<MemoryPtr, 2> buffers;
+    size_t current = 0;
 };
 
 }   // namespace intel_cpu
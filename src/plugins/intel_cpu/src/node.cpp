@@ -573,8 +573,12 @@ void Node::executeDynamic(dnnl::stream strm) {
 bool Node::outputShapeDataDependency() const {
     auto port_mask = shapeInference->get_port_mask();
     if (EMPTY_PORT_MASK != port_mask) {
-        for (size_t i = 0; i < getParentEdges().size(); ++i) {
-            if ((port_mask & (1 << i)) && !getParentEdgeAt(i)->getParent()->isConstant()) {
+        // the mask is by the input ports, while the order of the parent edges may differ
+        for (size_t port = 0; port < inputShapes.size(); ++port) {
+            if (!(port_mask & (1 << port)))
+                continue;
+            const auto edges = getParentEdgesAtPort(port);
+            if (!edges.empty() && !edges[0]->getParent()->isConstant()) {
                 return true;
             }
         }
@@ -793,37 +797,60 @@ void Node::prepareMemory(const std::vector<DnnlMemoryDescPtr>& intDescs) {
                    << internalBlobs.size() << " vs " << intDescs.size();
     }
 
+    // Constant inputs shared through the weights cache have the same data pointer in all the graphs using this cache
+    // (see Input::cloneBlobIfRequired and Edge::externalAllocate). So the pointers identify the data the internal blobs
+    // are built from and the content hashing can be skipped.
+    auto getConstInputsIdentity = [this](std::string& identity) {
+        bool hasConstInputs = false;
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            const auto edge = getParentEdgeAt(i);
+            const auto parent = edge->getParent();
+            if (!parent->isConstant())
+                continue;
+            if (!edge->isUseExternalMemory() && parent->getType() != Type::Input)
+                return false;
+            identity += "_" + std::to_string(reinterpret_cast<uint64_t>(edge->getMemoryPtr()->GetData()));
+            hasConstInputs = true;
+        }
+        return hasConstInputs;
+    };
+
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
-        auto create = [&] () {
+        auto pack = [&] (Memory& dst) {
             // TODO [DS]: internal blobs should be removed or rewritten using Memory object
             auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
 
             Memory memory{ engine };
             memory.Create(newDesc, internalBlob->buffer());
 
-            MemoryPtr _ptr = MemoryPtr(new Memory(engine));
-            _ptr->Create(*intDescs[i]);
-            _ptr->SetData(memory);
-
-            return _ptr;
+            dst.SetData(memory);
+        };
+        // the same weights packed by another compiled model are reused
+        auto createPacked = [&] () {
+            const auto srcDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
+            return context->getPackedWeights(internalBlob->buffer(), internalBlob->byteSize(), srcDesc, *intDescs[i],
+                                             pack);
         };
 
         MemoryPtr ptr;
         auto weightCache = context->getWeightsCache();
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            std::string data_id;
+            if (!getConstInputsIdentity(data_id)) {
+                data_id = "_" + std::to_string(weightCache->GetHashFunc().hash(
+                    internalBlob->buffer(), internalBlob->byteSize()));
+            }
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+                                            + data_id;
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = *weightCache->findOrCreate(string_hash, createPacked);
         } else {
-            ptr = create();
+            ptr = createPacked();
         }
 
         internalBlobMemory.push_back(ptr);
@@ -79,6 +79,18 @@ dnnl::memory::desc DnnlExecutor::getDstDesc() const {
     return md->getDnnlDesc();
 }
 
+size_t DnnlExecutor::getFootprint() const {
+    // oneDNN does not expose the size of the generated code, so a page per JIT kernel is assumed
+    constexpr size_t jitCodeSize = 4096;
+    const auto pd = getPrimitiveDesc();
+    size_t footprint = sizeof(*this) + DnnlExtensionUtils::query_md(pd, dnnl::query::scratchpad_md)->getCurrentMemSize();
+    if (getImplementationType() & impl_desc_type::jit)
+        footprint += jitCodeSize;
+    // the memory of the intermediate reorders is allocated on every execution, so only the code is counted
+    footprint += (inputReorders.size() + outputReorders.size()) * jitCodeSize;
+    return footprint;
+}
+
 impl_desc_type DnnlExecutor::getImplementationType() const {
     auto pd = getPrimitiveDesc();
     return parse_impl_name(DnnlExtensionUtils::query_impl_info_str(pd));
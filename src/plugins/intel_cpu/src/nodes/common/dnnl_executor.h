@@ -26,6 +26,9 @@ class DnnlExecutor {
         };
 
     public:
+        // exec keeps no state, so the executor may be shared by the streams (see IsReentrant)
+        static constexpr bool reentrant = true;
+
         void exec(std::unordered_map<int, dnnl::memory> primArgs, dnnl::stream strm);
         bool needReordering() const;
         virtual ~DnnlExecutor() = default;
@@ -35,6 +38,8 @@ class DnnlExecutor {
         dnnl::memory::desc getWeightDesc() const;
         dnnl::memory::desc getDstDesc() const;
         impl_desc_type getImplementationType() const;
+        // approximate memory footprint (the scratchpad and the generated code) used by the runtime cache
+        size_t getFootprint() const;
 
     protected:
         DnnlExecutor() = default;
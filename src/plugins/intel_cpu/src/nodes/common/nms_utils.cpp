@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// the first chunk of the sorted candidates
+constexpr size_t minSortChunk = 64;
+// the boxes processed at once by the vectorized IoU loop
+constexpr size_t iouBlockSize = 64;
+
+// the select of the float values by the float compares isn't vectorized (the compares may trap), the bitwise one is
+inline float zeroUnless(float value, bool keep) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits &= 0u - static_cast<uint32_t>(keep);
+    std::memcpy(&value, &bits, sizeof(bits));
+    return value;
+}
+}   // namespace
+
+void NmsSortedCandidates::reset(const float* scores, int boxesNum, float scoreThreshold, bool inclusive) {
+    _candidates.clear();
+    _sortedEnd = 0;
+    if (inclusive) {
+        for (int i = 0; i < boxesNum; i++) {
+            if (scores[i] >= scoreThreshold)
+                _candidates.emplace_back(scores[i], i);
+        }
+    } else {
+        for (int i = 0; i < boxesNum; i++) {
+            if (scores[i] > scoreThreshold)
+                _candidates.emplace_back(scores[i], i);
+        }
+    }
+}
+
+void NmsSortedCandidates::sortUpTo(size_t n) {
+    n = std::min(n, _candidates.size());
+    if (n <= _sortedEnd)
+        return;
+
+    const size_t end = std::min(_candidates.size(), std::max(n, _sortedEnd + std::max(_sortedEnd, minSortChunk)));
+    const auto first = _candidates.begin() + _sortedEnd;
+    const auto last = _candidates.begin() + end;
+    if (last != _candidates.end())
+        std::nth_element(first, last, _candidates.end(), greater);
+    std::sort(first, last, greater);
+    _sortedEnd = end;
+}
+
+void NmsBoxes::reserve(size_t n) {
+    for (auto* coord : {&_min0, &_min1, &_max0, &_max1, &_area})
+        coord->reserve(n);
+}
+
+void NmsBoxes::clear() {
+    for (auto* coord : {&_min0, &_min1, &_max0, &_max1, &_area})
+        coord->clear();
+}
+
+void NmsBoxes::push(const float* box) {
+    _min0.push_back(box[0]);
+    _min1.push_back(box[1]);
+    _max0.push_back(box[2]);
+    _max1.push_back(box[3]);
+    _area.push_back(area(box[0], box[1], box[2], box[3]));
+}
+
+template <NmsIouType type>
+void NmsBoxes::iouBlock(const float* box, size_t begin, size_t end, float* dst) const {
+    const float bMin0 = box[0], bMin1 = box[1], bMax0 = box[2], bMax1 = box[3];
+    const float bArea = area(bMin0, bMin1, bMax0, bMax1);
+    const float norm = _norm;
+    const float* min0 = _min0.data();
+    const float* min1 = _min1.data();
+    const float* max0 = _max0.data();
+    const float* max1 = _max1.data();
+    const float* areas = _area.data();
+
+    // no branches, so the loop is vectorized
+    for (size_t j = begin; j < end; j++) {
+        const float inter0 = std::min(bMax0, max0[j]) - std::max(bMin0, min0[j]) + norm;
+        const float inter1 = std::min(bMax1, max1[j]) - std::max(bMin1, min1[j]) + norm;
+        // the intersection of the boxes which aren't disjoint isn't clamped by the matrix NMS reference
+        const float inter = type == NmsIouType::MATRIX ? inter0 * inter1
+                                                       : std::max(inter0, 0.f) * std::max(inter1, 0.f);
+        const float iou = inter / (bArea + areas[j] - inter);
+        const bool valid = type == NmsIouType::MATRIX
+                               ? !((min0[j] > bMax0) | (max0[j] < bMin0) | (min1[j] > bMax1) | (max1[j] < bMin1))
+                               : (bArea > 0.f) & (areas[j] > 0.f);
+        dst[j - begin] = zeroUnless(iou, valid);
+    }
+}
+
+void NmsBoxes::iou(const float* box, size_t begin, size_t end, float* dst) const {
+    if (_type == NmsIouType::MATRIX) {
+        iouBlock<NmsIouType::MATRIX>(box, begin, end, dst);
+    } else {
+        iouBlock<NmsIouType::MULTICLASS>(box, begin, end, dst);
+    }
+}
+
+bool NmsBoxes::anyIouAtLeast(const float* box, size_t begin, float threshold) const {
+    float ious[iouBlockSize];
+    for (size_t blockBegin = begin; blockBegin < size(); blockBegin += iouBlockSize) {
+        const size_t blockEnd = std::min(blockBegin + iouBlockSize, size());
+        iou(box, blockBegin, blockEnd, ious);
+        int suppressed = 0;
+        for (size_t j = 0; j < blockEnd - blockBegin; j++)
+            suppressed |= static_cast<int>(ious[j] >= threshold);
+        if (suppressed)
+            return true;
+    }
+    return false;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief The candidate boxes of a class in the order of the decreasing score (the equal scores are ordered by the box
+ * index). The candidates are sorted on demand: the next chunk of the best candidates is selected with nth_element and
+ * only the chunk is sorted, the chunks grow twice. The greedy suppression usually stops after a small part of the
+ * candidates, so most of them are never sorted.
+ */
+class NmsSortedCandidates {
+public:
+    using Candidate = std::pair<float, int>;  // score, box index
+
+    /**
+     * @brief Collects the boxes with the score above the threshold (or not below it, if inclusive)
+     */
+    void reset(const float* scores, int boxesNum, float scoreThreshold, bool inclusive);
+
+    size_t size() const {
+        return _candidates.size();
+    }
+
+    /**
+     * @brief Sorts the candidates [0, n) if they aren't yet, it is worth to call it with the expected number of the
+     * candidates before the access
+     */
+    void sortUpTo(size_t n);
+
+    const Candidate& operator[](size_t i) {
+        if (i >= _sortedEnd)
+            sortUpTo(i + 1);
+        return _candidates[i];
+    }
+
+    static bool greater(const Candidate& l, const Candidate& r) {
+        return l.first > r.first || (l.first == r.first && l.second < r.second);
+    }
+
+private:
+    std::vector<Candidate> _candidates;
+    size_t _sortedEnd = 0;
+};
+
+enum class NmsIouType {
+    MULTICLASS,  // the IoU of a box with the non-positive area is zero
+    MATRIX,      // the IoU of the disjoint boxes is zero, the area of an inverted box is zero
+};
+
+/**
+ * @brief The boxes (min0, min1, max0, max1) in the structure of arrays layout, so IoU of a box with a block of the boxes
+ * is computed by the vectorized loops. The IoU is the same as computed for the pair of the boxes by the reference.
+ */
+class NmsBoxes {
+public:
+    NmsBoxes(NmsIouType type, bool normalized) : _type(type), _norm(normalized ? 0.f : 1.f) {}
+
+    void reserve(size_t n);
+
+    void clear();
+
+    size_t size() const {
+        return _area.size();
+    }
+
+    void push(const float* box);
+
+    /**
+     * @brief Computes IoU of the box with the boxes [begin, end)
+     */
+    void iou(const float* box, size_t begin, size_t end, float* dst) const;
+
+    /**
+     * @brief Checks whether IoU of the box with any of the boxes [begin, size()) is not less than the threshold
+     */
+    bool anyIouAtLeast(const float* box, size_t begin, float threshold) const;
+
+private:
+    float area(float min0, float min1, float max0, float max1) const {
+        if (_type == NmsIouType::MATRIX && (max0 < min0 || max1 < min1))
+            return 0.f;
+        return (max0 - min0 + _norm) * (max1 - min1 + _norm);
+    }
+
+    template <NmsIouType type>
+    void iouBlock(const float* box, size_t begin, size_t end, float* dst) const;
+
+    NmsIouType _type;
+    float _norm;
+    std::vector<float> _min0, _min1, _max0, _max1, _area;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -29,7 +29,7 @@ bool EmbeddingBagOffsetSum::isSupportedOperation(const std::shared_ptr<const ngr
 
 EmbeddingBagOffsetSum::EmbeddingBagOffsetSum(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
     : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)),
-      EmbeddingBagSum(op, 3lu, 1lu, 4lu, 3lu) {
+      EmbeddingBagSum(op, 3lu, 1lu, 4lu, 3lu, context->getConfig().embeddingTableQuantization) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -50,9 +50,9 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
     static const std::set<Precision> supportedPrecisions =
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
+    const auto tablePrecision = getTablePrecision(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX), getInputShapeAtPort(EMB_TABLE_IDX));
+    // BF16 table is accumulated in FP32
+    const auto inDataPrecision = tablePrecision == Precision::BF16 ? Precision::FP32 : tablePrecision;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -63,7 +63,7 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32}});
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
@@ -77,7 +77,7 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
 void EmbeddingBagOffsetSum::prepareParams() {
     _indicesLen = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[0];
     _offsetsLen = getParentEdgesAtPort(OFFSETS_IDX)[0]->getMemory().getStaticDims()[0];
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemoryPtr(), context->getWeightsCache());
 }
 
 void EmbeddingBagOffsetSum::initFromInputs() {
@@ -29,7 +29,7 @@ bool EmbeddingBagPackedSum::isSupportedOperation(const std::shared_ptr<const ngr
 
 EmbeddingBagPackedSum::EmbeddingBagPackedSum(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
     : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)),
-      EmbeddingBagSum(op, 2lu, 1lu, 2lu, 3lu) {
+      EmbeddingBagSum(op, 2lu, 1lu, 2lu, 3lu, context->getConfig().embeddingTableQuantization) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -47,9 +47,9 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
     static const std::set<Precision> supportedPrecisions =
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
+    const auto tablePrecision = getTablePrecision(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX), getInputShapeAtPort(EMB_TABLE_IDX));
+    // BF16 table is accumulated in FP32
+    const auto inDataPrecision = tablePrecision == Precision::BF16 ? Precision::FP32 : tablePrecision;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -60,7 +60,7 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, Precision::I32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
@@ -71,7 +71,7 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
 void EmbeddingBagPackedSum::prepareParams() {
     _batch = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[0];
     _indicesPerBag = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[1];
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemoryPtr(), context->getWeightsCache());
 }
 
 void EmbeddingBagPackedSum::initFromInputs() {
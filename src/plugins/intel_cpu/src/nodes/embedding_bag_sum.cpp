@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <functional>
+#include <numeric>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
@@ -10,6 +14,8 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "utils/bfloat16.hpp"
 
 using namespace InferenceEngine;
 
@@ -22,7 +28,8 @@ EmbeddingBagSum::EmbeddingBagSum(
             size_t requiredInputNum,
             size_t indicesIdx,
             size_t perSampleWeightsIdx,
-            size_t defaultIndexIdx) :
+            size_t defaultIndexIdx,
+            Config::EmbeddingTableQuantization tableQuantization) :
                 INDICES_IDX(indicesIdx),
                 PER_SAMPLE_WEIGHTS_IDX(perSampleWeightsIdx),
                 DEFAULT_INDEX_IDX(defaultIndexIdx) {
@@ -37,49 +44,183 @@ EmbeddingBagSum::EmbeddingBagSum(
         if (op->get_input_shape(PER_SAMPLE_WEIGHTS_IDX) != op->get_input_shape(INDICES_IDX))
              IE_THROW() << logPrefix << "must have equal shapes for indices and per_sample_weights inputs.";
     }
+
+    // only the constant table is quantized, as it is done once
+    const auto tableType = op->get_input_element_type(EMB_TABLE_IDX);
+    if (tableQuantization != Config::EmbeddingTableQuantization::ETQ_Off &&
+        ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(EMB_TABLE_IDX)) &&
+        (tableType == ngraph::element::f32 || tableType == ngraph::element::bf16)) {
+        const auto& dims = op->get_input_shape(EMB_TABLE_IDX);
+        const size_t embDepth = std::accumulate(dims.begin() + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+        const auto quantizedPrc =
+            tableQuantization == Config::EmbeddingTableQuantization::ETQ_Int8 ? Precision::U8 : Precision::U4;
+        if (jit_uni_emb_bag_kernel::isSupported({quantizedPrc, embDepth, _withWeights}))
+            _quantizedPrc = quantizedPrc;
+    }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+void EmbeddingBagSum::prepareParams(const MemoryPtr& tableMemory, const WeightsSharing::Ptr& weightsCache) {
+    const auto& indexStaticShape = tableMemory->getStaticDims();
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    auto tablePrc = tableMemory->getDesc().getPrecision();
+    if (_quantizedPrc != Precision::UNSPECIFIED) {
+        if (!_quantizedTable)
+            quantizeTable(tableMemory, weightsCache);
+        tablePrc = _quantizedPrc;
+    }
+
+    const jit_emb_bag_config_params jcp = {tablePrc, _embDepth, _withWeights};
+    if (_kernel && _kernel->jcp_.tablePrc == jcp.tablePrc && _kernel->jcp_.embDepth == jcp.embDepth)
+        return;
+    // the plain I8, U8 and I32 tables are summed as integers into the output of the same precision, they are
+    // processed by the reference implementation only, the kernel gathers FP32 and BF16 rows and the quantized tables
+    const bool jitOnly = tablePrc == Precision::BF16 || _quantizedPrc != Precision::UNSPECIFIED;
+    _kernel = (tablePrc == Precision::FP32 || jitOnly) ? jit_uni_emb_bag_kernel::create(jcp) : nullptr;
+    if (!_kernel && jitOnly)
+        IE_THROW() << "Node EmbeddingBagSum with name '" << _layerName << "' can't gather " << tablePrc.name()
+                   << " table with the row of " << _embDepth << " elements";
+}
+
+void EmbeddingBagSum::quantizeTable(const MemoryCPtr& tableMemory, const WeightsSharing::Ptr& weightsCache) {
+    const auto tablePrc = tableMemory->getDesc().getPrecision();
+    if (tablePrc != Precision::FP32 && tablePrc != Precision::BF16)
+        IE_THROW() << "Node EmbeddingBagSum with name '" << _layerName << "' can quantize only FP32 or BF16 table";
+
+    const auto* table = tableMemory->GetData();
+    const auto& dims = tableMemory->getStaticDims();
+    const size_t rowsNum = dims[0];
+    const size_t embDepth = std::accumulate(dims.begin() + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+    const auto quantizedPrc = _quantizedPrc;
+
+    auto create = [&]() {
+        const size_t rowSize = jit_uni_emb_bag_kernel::getRowSize(quantizedPrc, embDepth);
+        const float maxLevel = quantizedPrc == Precision::U8 ? 255.f : 15.f;
+
+        auto quantized = std::make_shared<Memory>(tableMemory->getEngine());
+        quantized->Create(CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{rowsNum, rowSize})));
+        auto* dst = reinterpret_cast<uint8_t*>(quantized->GetData());
+
+        // the asymmetric quantization of the row to [0, maxLevel]: q = round((x - min) / scale)
+        parallel_for(rowsNum, [&](size_t row) {
+            std::vector<float> converted;
+            const float* src = reinterpret_cast<const float*>(table) + row * embDepth;
+            if (tablePrc == Precision::BF16) {
+                const auto* bf16Row = reinterpret_cast<const bfloat16_t*>(table) + row * embDepth;
+                converted.assign(bf16Row, bf16Row + embDepth);
+                src = converted.data();
+            }
+            uint8_t* dstRow = dst + row * rowSize;
+            const auto minMax = std::minmax_element(src, src + embDepth);
+            const float bias = *minMax.first;
+            const float scale = (*minMax.second - bias) / maxLevel;
+            const float invScale = scale > 0.f ? 1.f / scale : 0.f;
+
+            std::fill(dstRow, dstRow + rowSize, 0);
+            for (size_t i = 0; i < embDepth; i++) {
+                const auto q = static_cast<uint8_t>(std::min(std::max(std::round((src[i] - bias) * invScale), 0.f), maxLevel));
+                if (quantizedPrc == Precision::U8) {
+                    dstRow[i] = q;
+                } else {
+                    dstRow[i / 2] |= static_cast<uint8_t>(q << (4 * (i % 2)));
+                }
+            }
+            float* params = reinterpret_cast<float*>(dstRow + rowSize - 2 * sizeof(float));
+            params[0] = scale;
+            params[1] = bias;
+        });
+        return quantized;
+    };
+
+    if (weightsCache) {
+        const std::string key = _layerName + "_quantized_table_" + quantizedPrc.name() +
+                                "_" + std::to_string(tableMemory->GetSize()) +
+                                "_" + std::to_string(reinterpret_cast<uint64_t>(table));
+        _quantizedTable = *weightsCache->findOrCreate(key, create);
+    } else {
+        _quantizedTable = create();
+    }
+}
+
+Precision EmbeddingBagSum::getTablePrecision(const Precision& originalPrc, const Shape& tableShape) const {
+    // the quantized table is made on the graph construction, the original table isn't converted then
+    if (_quantizedPrc != Precision::UNSPECIFIED)
+        return originalPrc;
+    if (originalPrc != Precision::BF16)
+        return originalPrc;
+    // the row size is needed to check the kernel support, BF16 tables are usually constants
+    if (tableShape.isStatic()) {
+        const auto& dims = tableShape.getStaticDims();
+        const size_t embDepth = std::accumulate(dims.begin() + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+        if (jit_uni_emb_bag_kernel::isSupported({Precision::BF16, embDepth, false}))
+            return Precision::BF16;
+    }
+    return Precision::FP32;
+}
+
+void EmbeddingBagSum::splitBagsByWork(size_t bagsNum, int nthr) {
+    size_t indicesSize = 0lu;
+    const int* indices = nullptr;
+    int weightsIdx = 0;
+    bool withWeights = _withWeights;
+
+    // every bag also writes the output row
+    _bagsWorkEnd.resize(bagsNum);
+    size_t work = 0lu;
+    for (size_t obi = 0; obi < bagsNum; obi++) {
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        work += (indices != nullptr ? indicesSize : 0lu) + 1lu;
+        _bagsWorkEnd[obi] = work;
+    }
+
+    _threadBagsStart.resize(nthr + 1);
+    for (int ithr = 0; ithr <= nthr; ithr++) {
+        _threadBagsStart[ithr] = std::upper_bound(_bagsWorkEnd.begin(), _bagsWorkEnd.end(), work * ithr / nthr) -
+                                 _bagsWorkEnd.begin();
+    }
+}
+
+void EmbeddingBagSum::throwInvalidIndex(int index) const {
+    IE_THROW() << "Node EmbeddingBagSum with name '" << _layerName << "' has invalid embedding bag index: " << index;
 }
 
 template<typename T>
 void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                                   const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
-    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
-
-    initFromInputs();
-
     const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
     auto *dstData = reinterpret_cast<T *>(outMemory->GetPtr());
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
+    const int nthr = parallel_get_max_threads();
+    splitBagsByWork(outputBagsNum, nthr);
+    // the indices are validated by the threads, the exception is thrown after the parallel section
+    std::atomic<bool> invalidIndexFound(false);
+    std::atomic<int> invalidIndex(0);
 
+    auto threadBody = [&](const int ithr, const int) {
         size_t indicesSize = 0lu;
         const int* indices = nullptr;
         int weightsIdx = 0lu;
         bool withWeights = _withWeights;
 
-        for (size_t obi = start; obi < end; obi++) {
+        for (size_t obi = _threadBagsStart[ithr]; obi < _threadBagsStart[ithr + 1]; obi++) {
             size_t dstIndex = obi * _embDepth;
             getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
 
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                        invalidIndex = indices[inIdx];
+                        invalidIndexFound = true;
+                        return;
+                    }
                 }
-                size_t srcIndex = indices[inIdx] * _embDepth;
 
+                size_t srcIndex = indices[0] * _embDepth;
                 if (withWeights) {
                     for (size_t i = 0lu; i < _embDepth; i++) {
                         dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
@@ -91,10 +232,7 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                     }
                 }
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
+                for (size_t inIdx = 1lu; inIdx < indicesSize; inIdx++) {
                     size_t srcIndex = indices[inIdx] * _embDepth;
 
                     if (withWeights) {
@@ -116,11 +254,66 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
         }
     };
 
-    parallel_nt(0, threadBody);
+    parallel_nt(nthr, threadBody);
+    if (invalidIndexFound)
+        throwInvalidIndex(invalidIndex);
+}
+
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const float* weightsData,
+                                     const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    auto *dstData = reinterpret_cast<float *>(outMemory->GetPtr());
+
+    const int nthr = parallel_get_max_threads();
+    splitBagsByWork(outputBagsNum, nthr);
+    std::atomic<bool> invalidIndexFound(false);
+    std::atomic<int> invalidIndex(0);
+    // the default index of the empty bag isn't weighted
+    static const float unitWeight = 1.f;
+
+    auto threadBody = [&](const int ithr, const int) {
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+
+        jit_emb_bag_call_args args;
+        args.table = srcData;
+        for (size_t obi = _threadBagsStart[ithr]; obi < _threadBagsStart[ithr + 1]; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr)
+                indicesSize = 0lu;
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    invalidIndex = indices[inIdx];
+                    invalidIndexFound = true;
+                    return;
+                }
+            }
+
+            args.indices = indices;
+            args.indicesNum = indicesSize;
+            args.weights = _withWeights ? (withWeights ? weightsData + weightsIdx : &unitWeight) : nullptr;
+            args.dst = dstData + obi * _embDepth;
+            (*_kernel)(&args);
+        }
+    };
+
+    parallel_nt(nthr, threadBody);
+    if (invalidIndexFound)
+        throwInvalidIndex(invalidIndex);
 }
 
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    initFromInputs();
+
+    if (_kernel) {
+        const auto* tableData = _quantizedTable ? reinterpret_cast<const uint8_t*>(_quantizedTable->GetData()) : srcData;
+        return processDataJit(tableData, reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
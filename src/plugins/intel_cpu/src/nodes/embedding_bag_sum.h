@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/embedding_bag_kernel.hpp"
 #include <string>
 #include <memory>
 #include <vector>
@@ -21,13 +22,28 @@ public:
             size_t requiredInputsNum,
             size_t indicesIdx,
             size_t perSampleWeightsIdx,
-            size_t defaultIndexIdx);
+            size_t defaultIndexIdx,
+            Config::EmbeddingTableQuantization tableQuantization);
 
     void execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                  const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory);
 
     ~EmbeddingBagSum() = default;
 
+    /**
+     * @brief Returns the precision of the table input: BF16 table is accumulated by the JIT kernel in FP32
+     * (the output and the per sample weights are FP32 then), the quantized table is read only on the graph
+     * construction, so it is kept in its own precision, the other tables are gathered in their own precision
+     */
+    InferenceEngine::Precision getTablePrecision(const InferenceEngine::Precision& originalPrc, const Shape& tableShape) const;
+
+    bool isTableQuantized() const {
+        return _quantizedPrc != InferenceEngine::Precision::UNSPECIFIED;
+    }
+    // quantizes the constant FP32 or BF16 table once on the graph construction, the quantized table is shared by the
+    // streams via the weights cache
+    void quantizeTable(const MemoryCPtr& tableMemory, const WeightsSharing::Ptr& weightsCache);
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -37,11 +53,16 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const MemoryPtr& tableMemory, const WeightsSharing::Ptr& weightsCache);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    void processDataJit(const uint8_t* srcData, const float* weightsData,
+                        const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    // splits the bags between the threads by the number of the gathered rows
+    void splitBagsByWork(size_t bagsNum, int nthr);
+    void throwInvalidIndex(int index) const;
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +72,13 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::shared_ptr<jit_uni_emb_bag_kernel> _kernel;
+    // U8 or U4 if the constant table is quantized row-wise, see jit_emb_bag_config_params
+    InferenceEngine::Precision _quantizedPrc = InferenceEngine::Precision::UNSPECIFIED;
+    MemoryPtr _quantizedTable;
+    std::vector<size_t> _bagsWorkEnd;      // the number of the rows gathered for all the bags up to the bag
+    std::vector<size_t> _threadBagsStart;  // the first bag of every thread, the last item is the number of the bags
 };
 
 }   // namespace node
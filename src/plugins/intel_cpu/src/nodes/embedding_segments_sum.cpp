@@ -29,7 +29,7 @@ bool EmbeddingSegmentsSum::isSupportedOperation(const std::shared_ptr<const ngra
 
 EmbeddingSegmentsSum::EmbeddingSegmentsSum(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
     : Node(op, context, NgraphShapeInferFactory(op, PortMask(NUM_SEGMENTS_IDX))),
-      EmbeddingBagSum(op, 4lu, 1lu, 5lu, 4lu) {
+      EmbeddingBagSum(op, 4lu, 1lu, 5lu, 4lu, context->getConfig().embeddingTableQuantization) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -53,9 +53,9 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
     static const std::set<Precision> supportedPrecisions =
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
+    const auto tablePrecision = getTablePrecision(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX), getInputShapeAtPort(EMB_TABLE_IDX));
+    // BF16 table is accumulated in FP32
+    const auto inDataPrecision = tablePrecision == Precision::BF16 ? Precision::FP32 : tablePrecision;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -66,7 +66,7 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32}});
@@ -79,7 +79,7 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemoryPtr(), context->getWeightsCache());
 }
 
 void EmbeddingSegmentsSum::initFromInputs() {
@@ -92,6 +92,18 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
+
+    // the bags are looked up per output segment, so the segments are indexed in one pass
+    segmentsStart_.assign(lastNumSegments_, -1);
+    segmentsSize_.assign(lastNumSegments_, 0lu);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const int segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= lastNumSegments_)
+            continue;
+        if (segmentsStart_[segmentId] < 0)
+            segmentsStart_[segmentId] = static_cast<int>(si);
+        segmentsSize_[segmentId]++;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -102,14 +114,10 @@ void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t&
     size = 0;
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    size = segmentsSize_[embIndex];
+    if (size != 0) {
+        indices = indices_ + segmentsStart_[embIndex];
+        weightsIdx = segmentsStart_[embIndex];
     }
 
     // Empty bag
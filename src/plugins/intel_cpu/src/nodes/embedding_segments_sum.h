@@ -47,6 +47,10 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    // the position of the first index and the number of the indices of every segment
+    std::vector<int> segmentsStart_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }   // namespace node
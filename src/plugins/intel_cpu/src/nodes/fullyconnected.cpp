@@ -909,17 +909,17 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     auto constDnnlMemOutDesc = blob->GetDescWithType<DnnlMemoryDesc>();
     auto weightSrcDesc = constDnnlMemOutDesc->getDnnlDesc();
     weightSrcDesc = weightSrcDesc.reshape(weightDesc->getDnnlDesc().dims());
-    auto create = [&] () {
+    auto pack = [&] (Memory& dst) {
         auto newSrcDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
 
         Memory srcMemory{ getEngine() };
         srcMemory.Create(newSrcDesc, blob->GetData());
 
-        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
-        _ptr->Create(weightDesc);
-        node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
-
-        return _ptr;
+        node::Reorder::reorderData(srcMemory, dst, context->getParamsCache());
+    };
+    // the same weights packed by another compiled model are reused
+    auto createPacked = [&] () {
+        return context->getPackedWeights(blob->GetData(), blob->GetSize(), *constDnnlMemOutDesc, *weightDesc, pack);
     };
 
     MemoryPtr ptr;
@@ -934,9 +934,9 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
                                             + "_" + std::to_string(blob->GetSize())
                                             + "_" + std::to_string(reinterpret_cast<uint64_t>(blob->GetData()));
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = *weightCache->findOrCreate(string_hash, createPacked);
         } else {
-            ptr = create();
+            ptr = createPacked();
         }
         privateWeightCache[format] = ptr;
     }
@@ -245,17 +245,16 @@ Input::Input(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr c
     constOp = ngraph::as_type_ptr<ngraph::op::Constant>(op);
     if (constOp) {
         constant = ConstantType::Const;
-        cloneBlobIfRequired();
     }
 }
 
-void Input::cloneBlobIfRequired() {
+void Input::cloneBlobIfRequired() const {
     Shape shape(constOp->get_shape().empty() ? ngraph::Shape(1, 1) : constOp->get_shape());
     const auto prec = convertPrecision(constOp->get_element_type());
     const size_t size = shape.getElementsCount();
     DnnlBlockedMemoryDesc memDesc(prec, shape);
 
-    auto cloneBlob = [&, this] () {
+    auto cloneBlob = [&, this] (Memory& dst) {
         Memory memory{ getEngine() };
 
         // CVS-74980
@@ -269,11 +268,11 @@ void Input::cloneBlobIfRequired() {
             memcpy(memory.GetPtr(), constOp->get_data_ptr(), constOp->get_byte_size());
         }
 
-        MemoryPtr ptr = MemoryPtr(new Memory(getEngine()));
-        ptr->Create(memDesc);
-        ptr->SetData(memory);
-
-        return ptr;
+        dst.SetData(memory);
+    };
+    // the same constant copied by another compiled model is reused
+    auto clonePackedBlob = [&, this] () {
+        return context->getPackedWeights(constOp->get_data_ptr(), constOp->get_byte_size(), memDesc, memDesc, cloneBlob);
     };
 
     auto isBlobAligned = [&, this] () {
@@ -352,15 +351,19 @@ void Input::cloneBlobIfRequired() {
     };
 
     auto weightCache = context->getWeightsCache();
-    if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+    if (isConstDataShared && isBlobAligned()) {
+        auto ptr = new Memory(getEngine());
+        ptr->Create(memDesc, constOp->get_data_ptr());
+        memoryPtr = MemoryCPtr(ptr);
+    } else if (weightCache) {
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), clonePackedBlob);
         memoryPtr = std::const_pointer_cast<const Memory>(ptr);
     } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
         auto ptr = new Memory(getEngine());
         ptr->Create(memDesc, constOp->get_data_ptr());
         memoryPtr = MemoryCPtr(ptr);
     } else {
-        memoryPtr = std::const_pointer_cast<const Memory>(cloneBlob());
+        memoryPtr = std::const_pointer_cast<const Memory>(clonePackedBlob());
     }
 }
 
@@ -389,7 +392,14 @@ void Input::withMeanImage() {
     isMeanImage = true;
 }
 
+void Input::withSharedConstData() {
+    isConstDataShared = true;
+}
+
 MemoryCPtr Input::getMemoryPtr() const {
+    // the constant is copied on the first use, so the graph optimizations may replace it before
+    if (constOp && !memoryPtr)
+        cloneBlobIfRequired();
     return memoryPtr;
 }
 
@@ -29,6 +29,9 @@ public:
     bool created() const override;
 
     void withMeanImage();
+    // the memory of the constant wraps the data of the ngraph constant instead of a copy, if it is aligned
+    // (e.g. the data read only on the graph construction)
+    void withSharedConstData();
     MemoryCPtr getMemoryPtr() const;
 
     void executeDynamicImpl(dnnl::stream strm) override {}
@@ -40,15 +43,17 @@ public:
     bool needPrepareParams() const override { return false; }
 
 private:
-    void cloneBlobIfRequired();
+    void cloneBlobIfRequired() const;
     void initSupportedPdDefault();
     void initSupportedPdFromMemDesc();
 
 private:
     std::shared_ptr<ngraph::op::Constant> constOp;
-    MemoryCPtr memoryPtr;
+    // the memory of the constant is created on the first use
+    mutable MemoryCPtr memoryPtr;
     MemoryDescPtr extMemDesc = nullptr;
     bool isMeanImage = false;
+    bool isConstDataShared = false;
 };
 
 }   // namespace node
@@ -0,0 +1,257 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+
+#include <algorithm>
+#include <limits>
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t cacheLineSize = 64;
+// the first lanes of the avx2 tail mask are loaded starting from the (8 - tail) element
+alignas(32) const int32_t avx2TailMask[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+// the U4 elements of a vector are broadcasted by dwords (the avx512 vector takes 2 dwords), then shifted into place
+alignas(64) const int32_t u4Shifts[16] = {0, 4, 8, 12, 16, 20, 24, 28, 0, 4, 8, 12, 16, 20, 24, 28};
+alignas(64) const int32_t u4Perm[16] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1};
+const int32_t u4Mask = 0xF;
+// the scale and the bias of the quantized row
+constexpr size_t quantizationParamsSize = 2 * sizeof(float);
+}   // namespace
+
+size_t jit_uni_emb_bag_kernel::getRowSize(const InferenceEngine::Precision& tablePrc, size_t embDepth) {
+    if (tablePrc == InferenceEngine::Precision::U8)
+        return rnd_up(embDepth, sizeof(float)) + quantizationParamsSize;
+    if (tablePrc == InferenceEngine::Precision::U4)
+        return rnd_up(div_up(embDepth, 2), sizeof(float)) + quantizationParamsSize;
+    return embDepth * tablePrc.size();
+}
+
+bool jit_uni_emb_bag_kernel::isSupported(const jit_emb_bag_config_params& jcp) {
+    if (jcp.embDepth == 0 ||
+        getRowSize(jcp.tablePrc, jcp.embDepth) > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return false;
+    if (jcp.tablePrc == InferenceEngine::Precision::FP32 || jcp.tablePrc == InferenceEngine::Precision::U8 ||
+        jcp.tablePrc == InferenceEngine::Precision::U4)
+        return mayiuse(avx2);
+    // the avx2 kernel has no masked load of the BF16 tail
+    if (jcp.tablePrc == InferenceEngine::Precision::BF16)
+        return mayiuse(avx512_core) || (mayiuse(avx2) && jcp.embDepth % 8 == 0);
+    return false;
+}
+
+std::shared_ptr<jit_uni_emb_bag_kernel> jit_uni_emb_bag_kernel::create(const jit_emb_bag_config_params& jcp) {
+    if (!isSupported(jcp))
+        return nullptr;
+
+    std::shared_ptr<jit_uni_emb_bag_kernel> kernel;
+    if (mayiuse(avx512_core)) {
+        kernel.reset(new jit_uni_emb_bag_kernel_f32<avx512_core>(jcp));
+    } else {
+        kernel.reset(new jit_uni_emb_bag_kernel_f32<avx2>(jcp));
+    }
+    kernel->create_ker();
+    return kernel;
+}
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_emb_bag_kernel_f32<isa>::jit_uni_emb_bag_kernel_f32(const jit_emb_bag_config_params& jcp)
+    : jit_uni_emb_bag_kernel(jcp), jit_generator(jit_name()) {}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::generate() {
+    this->preamble();
+
+    mov(reg_table, ptr[reg_params + GET_OFF(table)]);
+    mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+    mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_indices_num, ptr[reg_params + GET_OFF(indicesNum)]);
+
+    const int rowBytes = static_cast<int>(getRowSize(jcp_.tablePrc, jcp_.embDepth));
+    const int paramsOffset = rowBytes - static_cast<int>(quantizationParamsSize);
+    const size_t fullVecs = jcp_.embDepth / simdWidth;
+    const size_t tail = jcp_.embDepth % simdWidth;
+    const size_t rowVecs = fullVecs + (tail ? 1 : 0);
+
+    if (tail) {
+        if (isa == avx512_core) {
+            mov(reg_tmp.cvt32(), (1 << tail) - 1);
+            kmovw(k_tail_mask, reg_tmp.cvt32());
+        } else {
+            mov(reg_tmp, reinterpret_cast<size_t>(&avx2TailMask[8 - tail]));
+            uni_vmovups(vmm_tail_mask, ptr[reg_tmp]);
+        }
+    }
+    if (jcp_.tablePrc == InferenceEngine::Precision::U4) {
+        mov(reg_tmp, reinterpret_cast<size_t>(u4Shifts));
+        uni_vmovups(vmm_u4_shifts, ptr[reg_tmp]);
+        mov(reg_tmp, reinterpret_cast<size_t>(&u4Mask));
+        vpbroadcastd(vmm_u4_mask, ptr[reg_tmp]);
+        if (isa == avx512_core) {
+            mov(reg_tmp, reinterpret_cast<size_t>(u4Perm));
+            uni_vmovups(vmm_u4_perm, ptr[reg_tmp]);
+        }
+    }
+
+    for (size_t blockStart = 0; blockStart < rowVecs; blockStart += maxBlockVecs) {
+        const size_t blockVecs = std::min(maxBlockVecs, rowVecs - blockStart);
+        const size_t blockOffset = getRowOffset(blockStart * simdWidth);
+        const size_t blockBytes =
+            getRowOffset(std::min((blockStart + blockVecs) * simdWidth, jcp_.embDepth)) - blockOffset;
+
+        for (size_t v = 0; v < blockVecs; v++) {
+            uni_vpxor(Vmm(v), Vmm(v), Vmm(v));
+        }
+        // the biases of the quantized rows are the same for all the elements, so they are summed up separately
+        if (isQuantized())
+            uni_vpxor(vmm_bias_sum, vmm_bias_sum, vmm_bias_sum);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        Xbyak::Label prefetch_end_label;
+
+        xor_(reg_i, reg_i);
+        L(loop_label);
+        {
+            cmp(reg_i, reg_indices_num);
+            jge(loop_end_label, T_NEAR);
+
+            movsxd(reg_row, dword[reg_indices + reg_i * 4]);
+            imul(reg_row, reg_row, rowBytes);
+            add(reg_row, reg_table);
+
+            // the block of the row a few indices ahead
+            lea(reg_tmp, ptr[reg_i + prefetchDistance]);
+            cmp(reg_tmp, reg_indices_num);
+            jge(prefetch_end_label, T_NEAR);
+            movsxd(reg_prefetch_row, dword[reg_indices + reg_tmp * 4]);
+            imul(reg_prefetch_row, reg_prefetch_row, rowBytes);
+            add(reg_prefetch_row, reg_table);
+            for (size_t offset = 0; offset < blockBytes; offset += cacheLineSize) {
+                prefetcht0(ptr[reg_prefetch_row + blockOffset + offset]);
+            }
+            // the row may be not aligned to the cache line
+            prefetcht0(ptr[reg_prefetch_row + blockOffset + blockBytes - 1]);
+            if (isQuantized())
+                prefetcht0(ptr[reg_prefetch_row + paramsOffset]);
+            L(prefetch_end_label);
+
+            if (jcp_.withWeights)
+                uni_vbroadcastss(vmm_weight, ptr[reg_weights + reg_i * 4]);
+
+            if (isQuantized()) {
+                // w * (q * scale + bias) = q * (w * scale) + w * bias
+                uni_vbroadcastss(vmm_scale, ptr[reg_row + paramsOffset]);
+                uni_vbroadcastss(vmm_bias, ptr[reg_row + paramsOffset + sizeof(float)]);
+                if (jcp_.withWeights) {
+                    uni_vmulps(vmm_scale, vmm_scale, vmm_weight);
+                    uni_vmulps(vmm_bias, vmm_bias, vmm_weight);
+                }
+                uni_vaddps(vmm_bias_sum, vmm_bias_sum, vmm_bias);
+            }
+
+            for (size_t v = 0; v < blockVecs; v++) {
+                const size_t vec = blockStart + v;
+                loadRow(vmm_row, ptr[reg_row + getRowOffset(vec * simdWidth)], tail && vec == fullVecs);
+                if (isQuantized()) {
+                    uni_vfmadd231ps(Vmm(v), vmm_row, vmm_scale);
+                } else if (jcp_.withWeights) {
+                    uni_vfmadd231ps(Vmm(v), vmm_row, vmm_weight);
+                } else {
+                    uni_vaddps(Vmm(v), Vmm(v), vmm_row);
+                }
+            }
+
+            inc(reg_i);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        for (size_t v = 0; v < blockVecs; v++) {
+            const size_t vec = blockStart + v;
+            if (isQuantized())
+                uni_vaddps(Vmm(v), Vmm(v), vmm_bias_sum);
+            storeRow(ptr[reg_dst + vec * simdWidth * sizeof(float)], Vmm(v), tail && vec == fullVecs);
+        }
+    }
+
+    this->postamble();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+size_t jit_uni_emb_bag_kernel_f32<isa>::getRowOffset(size_t elem) const {
+    if (jcp_.tablePrc == InferenceEngine::Precision::U4)
+        return div_up(elem, 2);
+    return elem * jcp_.tablePrc.size();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::loadRow(const Vmm& vmm, const Xbyak::Address& addr, bool tail) {
+    // the quantized rows are padded and followed by the scale and the bias, so the vector of the tail is read
+    // within the row, except the U8 avx512 vector which is masked
+    if (jcp_.tablePrc == InferenceEngine::Precision::U8) {
+        if (tail && isa == avx512_core) {
+            vpmovzxbd(vmm | k_tail_mask | T_z, addr);
+        } else {
+            vpmovzxbd(vmm, addr);
+        }
+        uni_vcvtdq2ps(vmm, vmm);
+    } else if (jcp_.tablePrc == InferenceEngine::Precision::U4) {
+        if (isa == avx512_core) {
+            vpbroadcastq(vmm, addr);
+            vpermd(vmm, vmm_u4_perm, vmm);
+        } else {
+            vpbroadcastd(vmm, addr);
+        }
+        vpsrlvd(vmm, vmm, vmm_u4_shifts);
+        uni_vpand(vmm, vmm, vmm_u4_mask);
+        uni_vcvtdq2ps(vmm, vmm);
+    } else if (jcp_.tablePrc == InferenceEngine::Precision::BF16) {
+        // BF16 is the upper half of FP32
+        if (tail) {
+            vpmovzxwd(vmm | k_tail_mask | T_z, addr);
+        } else {
+            vpmovzxwd(vmm, addr);
+        }
+        uni_vpslld(vmm, vmm, 16);
+    } else if (!tail) {
+        uni_vmovups(vmm, addr);
+    } else if (isa == avx512_core) {
+        vmovups(vmm | k_tail_mask | T_z, addr);
+    } else {
+        vmaskmovps(vmm, vmm_tail_mask, addr);
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_emb_bag_kernel_f32<isa>::storeRow(const Xbyak::Address& addr, const Vmm& vmm, bool tail) {
+    if (!tail) {
+        uni_vmovups(addr, vmm);
+    } else if (isa == avx512_core) {
+        vmovups(addr | k_tail_mask, vmm);
+    } else {
+        vmaskmovps(addr, vmm_tail_mask, vmm);
+    }
+}
+
+template struct jit_uni_emb_bag_kernel_f32<cpu::x64::avx2>;
+template struct jit_uni_emb_bag_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cassert>
+#include <memory>
+
+#include <ie_precision.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * The table rows are accumulated and stored in FP32. FP32 and BF16 tables are gathered as is, U8 and U4 are the row-wise
+ * quantized tables: the row of the unsigned integers (U4 are packed by two, the low half of the byte first) is padded to
+ * 4 bytes and followed by FP32 scale and bias, the value is q * scale + bias.
+ */
+struct jit_emb_bag_config_params {
+    InferenceEngine::Precision tablePrc;  // FP32, BF16, U8 or U4
+    size_t embDepth;                      // the number of elements in the row of the table
+    bool withWeights;
+};
+
+struct jit_emb_bag_call_args {
+    const uint8_t* table;
+    const int* indices;    // the indices of the bag rows, must be validated by the caller
+    const float* weights;  // the per sample weights of the bag rows
+    float* dst;
+    size_t indicesNum;     // zero for the empty bag, the output row is zeroed then
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args*);
+
+    void operator()(const jit_emb_bag_call_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_kernel(const jit_emb_bag_config_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    /**
+     * @brief Creates the kernel for the best ISA of the host
+     * @return nullptr if the configuration isn't supported on the host
+     */
+    static std::shared_ptr<jit_uni_emb_bag_kernel> create(const jit_emb_bag_config_params& jcp);
+
+    static bool isSupported(const jit_emb_bag_config_params& jcp);
+
+    // the size of the table row in bytes including the scale and the bias of the quantized rows
+    static size_t getRowSize(const InferenceEngine::Precision& tablePrc, size_t embDepth);
+
+    jit_emb_bag_config_params jcp_;
+};
+
+/**
+ * @brief Gathers the rows of the embedding table and accumulates them (multiplied by the per sample weights) into one
+ * output row. The row is processed by the blocks of the vector registers: the accumulators of a block stay in the
+ * registers while the bag indices are iterated, and the same block of the row a few indices ahead is prefetched,
+ * as the tables are usually much larger than the caches and the rows are accessed randomly. The quantized rows are
+ * dequantized on load, the biases are accumulated once per row.
+ */
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_emb_bag_kernel_f32 : public jit_uni_emb_bag_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_kernel_f32)
+
+    explicit jit_uni_emb_bag_kernel_f32(const jit_emb_bag_config_params& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    const size_t simdWidth = vlen / sizeof(float);
+    // the number of the accumulators kept in the registers
+    const size_t maxBlockVecs = isa == dnnl::impl::cpu::x64::avx2 ? 8 : 16;
+    // how many indices ahead the rows are prefetched
+    static constexpr int prefetchDistance = 4;
+
+    bool isQuantized() const {
+        return jcp_.tablePrc == InferenceEngine::Precision::U8 || jcp_.tablePrc == InferenceEngine::Precision::U4;
+    }
+    // the offset of the element in the table row in bytes
+    size_t getRowOffset(size_t elem) const;
+
+    void loadRow(const Vmm& vmm, const Xbyak::Address& addr, bool tail);
+    void storeRow(const Xbyak::Address& addr, const Vmm& vmm, bool tail);
+
+    Xbyak::Reg64 reg_table = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_i = r13;
+    Xbyak::Reg64 reg_row = r14;
+    Xbyak::Reg64 reg_prefetch_row = r15;
+    Xbyak::Reg64 reg_tmp = rax;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    // the accumulators are Vmm(0) ... Vmm(maxBlockVecs - 1)
+    Vmm vmm_row = Vmm(maxBlockVecs);
+    Vmm vmm_weight = Vmm(maxBlockVecs + 1);
+    Vmm vmm_tail_mask = Vmm(maxBlockVecs + 2);  // avx2 only
+    Xbyak::Opmask k_tail_mask = Xbyak::Opmask(1);  // avx512 only
+    // the quantized tables only
+    Vmm vmm_scale = Vmm(maxBlockVecs + 3);
+    Vmm vmm_bias = Vmm(maxBlockVecs + 4);
+    Vmm vmm_bias_sum = Vmm(maxBlockVecs + 5);
+    Vmm vmm_u4_shifts = Vmm(maxBlockVecs + 6);
+    Vmm vmm_u4_mask = Vmm(maxBlockVecs + 7);
+    Vmm vmm_u4_perm = Vmm(maxBlockVecs + 8);  // avx512 only
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
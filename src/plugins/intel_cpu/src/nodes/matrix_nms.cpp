@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "common/nms_utils.h"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
@@ -133,49 +134,11 @@ bool MatrixNms::created() const {
     return getType() == Type::MatrixNms;
 }
 
-namespace {
-
-static inline float boxArea(const float* bbox, const bool normalized) {
-    if (bbox[2] < bbox[0] || bbox[3] < bbox[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float width = bbox[2] - bbox[0];
-        const float height = bbox[3] - bbox[1];
-        if (normalized) {
-            return width * height;
-        } else {
-            return (width + 1) * (height + 1);
-        }
-    }
-}
-
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
-}  // namespace
-
 size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
-    std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
+    NmsSortedCandidates candidates;
+    candidates.reset(scoresData, static_cast<int>(m_numBoxes), m_scoreThreshold, false);
     int64_t numDet = 0;
-    int64_t originalSize = std::distance(candidateIndex.begin(), end);
+    int64_t originalSize = candidates.size();
     if (originalSize <= 0) {
         return 0;
     }
@@ -183,9 +146,15 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
         originalSize = m_nmsTopk;
     }
 
-    std::partial_sort(candidateIndex.begin(), candidateIndex.begin() + originalSize, end, [&scoresData](int32_t a, int32_t b) {
-        return scoresData[a] > scoresData[b];
-    });
+    // the equal scores are ordered by the box index, so the result doesn't depend on the sort implementation
+    candidates.sortUpTo(originalSize);
+    std::vector<int32_t> candidateIndex(originalSize);
+    NmsBoxes candidateBoxes(NmsIouType::MATRIX, m_normalized);
+    candidateBoxes.reserve(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        candidateIndex[i] = candidates[i].second;
+        candidateBoxes.push(boxesData + candidateIndex[i] * 4);
+    }
 
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
@@ -195,12 +164,10 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
         float max_iou = 0.;
         size_t actual_index = i + 1;
         auto idx_a = candidateIndex[actual_index];
-        for (int64_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
-        }
+        float* iouRow = iouMatrix.data() + actual_index * (actual_index - 1) / 2;
+        candidateBoxes.iou(boxesData + idx_a * 4, 0, actual_index, iouRow);
+        for (size_t j = 0; j < actual_index; j++)
+            max_iou = std::max(max_iou, iouRow[j]);
         iouMax[actual_index] = max_iou;
     });
 
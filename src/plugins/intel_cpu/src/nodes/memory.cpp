@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
@@ -31,8 +32,8 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_input_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -89,8 +90,8 @@ void MemoryOutput::execute(dnnl::stream strm)  {
 
 bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_output_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -120,7 +121,13 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    const auto& desc = getChildEdgeAt(0)->getMemory().getDesc();
+    if (desc.isDefined()) {
+        dataStore->Create(desc);
+    } else {
+        // the initial state of the variable with dynamic shape is the smallest one (usually empty)
+        dataStore->Create(desc.cloneWithNewDims(desc.getShape().getMinDims(), true));
+    }
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
@@ -158,18 +165,82 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+MemoryDescPtr MemoryInput::getStateDesc() const {
+    return getBaseMemDescAtOutputPort(0);
+}
+
+void MemoryInput::setStateBuffers(const MemoryPtr& current, const MemoryPtr& next, bool bindEdges) {
+    dataStore = current;
+    nextStore = next;
+    stateUpdated = false;
+    this->bindEdges = bindEdges;
+    // otherwise the edges are bound once they are redefined to the shape of the state
+    const auto& desc = getChildEdgeAt(0)->getMemory().getDesc();
+    if (desc.isDefined() && desc.getShape().getStaticDims() == dataStore->getStaticDims())
+        bindStore();
+}
+
+void MemoryInput::bindStore() {
+    auto data = dataStore->GetData();
+    if (!bindEdges || data == nullptr)
+        return;
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        const auto& memory = getChildEdgeAt(i)->getMemoryPtr();
+        if (memory->GetData() != data)
+            memory->setDataHandle(data);
+    }
+}
+
+bool MemoryInput::needShapeInfer() const {
+    if (!isDynamicNode())
+        return false;
+    const auto& shape = getChildEdgeAt(0)->getMemory().getShape();
+    return !shape.isStatic() || shape.getStaticDims() != dataStore->getStaticDims();
+}
+
+std::vector<VectorDims> MemoryInput::shapeInfer() const {
+    return {dataStore->getStaticDims()};
+}
+
+void MemoryInput::redefineOutputMemory(const std::vector<VectorDims> &newShapes) {
+    Node::redefineOutputMemory(newShapes);
+    // the redefined edges have their own memory
+    bindStore();
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    const auto& store = nextStore ? nextStore : dataStore;
+    if (isDynamicNode()) {
+        // the buffers of the request grow geometrically, so the state growing step by step is rarely reallocated
+        const auto& dims = new_state.getStaticDims();
+        if (store->getStaticDims() != dims) {
+            const bool hasZeroDims = std::count(dims.begin(), dims.end(), 0) > 0;
+            store->redefineDesc(getBaseMemDescAtOutputPort(0)->cloneWithNewDims(dims, hasZeroDims));
+        }
+    }
+    // the producer has written the state to the store in place
+    if (new_state.GetData() != store->GetData()) {
+        // TODO: Should be next one call:
+        //           dataStore.SetData(new_state, false);
+        //       But because of performance reason we use simple manual copy
+        simple_copy(*store, new_state);
+    }
+    stateUpdated = true;
+}
+
+void MemoryInput::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    // the consumers read the store in place
+    if (dstMemory.GetData() == dataStore->GetData())
+        return;
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dstMemory, *dataStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -68,14 +68,28 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
 
+    bool needShapeInfer() const override {
+        return false;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
+
     void setInputNode(Node* node) override {
         inputNode = node;
     }
 
+    Node* getInputNode() const {
+        return inputNode;
+    }
+
  private:
     /**
      * @brief keeps reference to input sibling node
@@ -97,14 +111,48 @@ public:
         return true;
     }
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
 
     void createPrimitive() override;
 
+    // the output shape of the dynamic node is the shape of the current state
+    bool needShapeInfer() const override;
+
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+    /**
+     * @brief The descriptor of the variable, its shape is dynamic if the state shape may change between inferences
+     */
+    MemoryDescPtr getStateDesc() const;
+
+    /**
+     * @brief Sets the state buffers of the infer request: the node reads the state from the current buffer and
+     * storeState writes the new state to the next one.
+     * @param bindEdges whether the child edges may read the current buffer in place, so no copy is made
+     */
+    void setStateBuffers(const MemoryPtr& current, const MemoryPtr& next, bool bindEdges);
+    MemoryPtr getNextStore() {
+        return nextStore;
+    }
+    /**
+     * @brief Whether the new state has been stored to the next buffer since the buffers were set
+     */
+    bool isStateUpdated() const {
+        return stateUpdated;
+    }
+
+protected:
+    std::vector<VectorDims> shapeInfer() const override;
+    void redefineOutputMemory(const std::vector<VectorDims> &newShapes) override;
+
  private:
+    void bindStore();
+
     MemoryPtr dataStore;
+    MemoryPtr nextStore;  // nullptr means the new state replaces the current one
+    bool stateUpdated = false;
+    bool bindEdges = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
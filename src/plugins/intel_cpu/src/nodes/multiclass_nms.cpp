@@ -10,12 +10,12 @@
 #include <chrono>
 #include <cmath>
 #include <ie_ngraph_utils.hpp>
-#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "common/nms_utils.h"
 #include "utils/general_utils.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
@@ -388,30 +388,6 @@ bool MultiClassNms::created() const {
     return getType() == Type::MulticlassNms;
 }
 
-float MultiClassNms::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    const float norm = static_cast<float>(normalized == false);
-
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
-}
-
 void MultiClassNms::nmsWithEta(const float* boxes,
                                 const float* scores,
                                 const int* roisnum,
@@ -419,14 +395,6 @@ void MultiClassNms::nmsWithEta(const float* boxes,
                                 const SizeVector& scoresStrides,
                                 const SizeVector& roisnumStrides,
                                 const bool shared) {
-    auto less = [](const boxInfo& l, const boxInfo& r) {
-        return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
-    };
-
-    auto func = [](float iou, float adaptive_threshold) {
-        return iou <= adaptive_threshold ? 1.0f : 0.0f;
-    };
-
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         if (!shared) {
             if (roisnum[batch_idx] <= 0) {
@@ -435,58 +403,36 @@ void MultiClassNms::nmsWithEta(const float* boxes,
             }
         }
         if (class_idx != m_backgroundClass) {
-            std::vector<filteredBoxes> fb;
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-            }
-            fb.reserve(sorted_boxes.size());
-            if (sorted_boxes.size() > 0) {
-                auto adaptive_threshold = m_iouThreshold;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                while (max_out_box && !sorted_boxes.empty()) {
-                    boxInfo currBox = sorted_boxes.top();
-                    float origScore = currBox.score;
-                    sorted_boxes.pop();
-                    max_out_box--;
-
-                    bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], m_normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                        if (currBox.score <= m_scoreThreshold)
-                            break;
-                    }
+            NmsSortedCandidates candidates;
+            candidates.reset(scoresPtr, cur_numBoxes, m_scoreThreshold, true);  // align with ref
+            const size_t max_out_box = std::min(static_cast<size_t>(m_nmsRealTopk), candidates.size());
+            candidates.sortUpTo(max_out_box);
 
-                    currBox.suppress_begin_index = fb.size();
-                    if (box_is_selected) {
-                        if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
-                            adaptive_threshold *= m_nmsEta;
-                        }
-                        if (currBox.score == origScore) {
-                            fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
-                            continue;
-                        }
-                        if (currBox.score > m_scoreThreshold) {
-                            sorted_boxes.push(currBox);
-                        }
-                    }
-                }
-            }
-            m_numFiltBox[batch_idx][class_idx] = fb.size();
+            NmsBoxes selectedBoxes(NmsIouType::MULTICLASS, m_normalized);
+            selectedBoxes.reserve(max_out_box);
             size_t offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-            for (size_t i = 0; i < fb.size(); i++) {
-                m_filtBoxes[offset + i] = fb[i];
+            auto adaptive_threshold = m_iouThreshold;
+            for (size_t candidate_idx = 0; candidate_idx < max_out_box; candidate_idx++) {
+                const auto& candidate = candidates[candidate_idx];
+                const float* candidateBox = &boxesPtr[candidate.second * 4];
+                // the reference stops the check after the last selected box if the score is at the threshold
+                size_t check_begin = 0;
+                if (candidate.first <= m_scoreThreshold && selectedBoxes.size() > 0)
+                    check_begin = selectedBoxes.size() - 1;
+                if (selectedBoxes.anyIouAtLeast(candidateBox, check_begin, adaptive_threshold))
+                    continue;
+
+                if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
+                    adaptive_threshold *= m_nmsEta;
+                }
+                m_filtBoxes[offset + selectedBoxes.size()] = filteredBoxes(candidate.first, batch_idx, class_idx, candidate.second);
+                selectedBoxes.push(candidateBox);
             }
+            m_numFiltBox[batch_idx][class_idx] = selectedBoxes.size();
         }
     });
 }
@@ -546,41 +492,25 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
             const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
             const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
 
-            std::vector<std::pair<float, int>> sorted_boxes;
             int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // align with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-            }
-
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
-                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
-                }
+            NmsSortedCandidates candidates;
+            candidates.reset(scoresPtr, cur_numBoxes, m_scoreThreshold, true);  // align with ref
+            const size_t max_out_box = std::min(static_cast<size_t>(m_nmsRealTopk), candidates.size());
+            candidates.sortUpTo(max_out_box);
+
+            NmsBoxes selectedBoxes(NmsIouType::MULTICLASS, m_normalized);
+            selectedBoxes.reserve(max_out_box);
+            int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
+            for (size_t candidate_idx = 0; candidate_idx < max_out_box; candidate_idx++) {
+                const auto& candidate = candidates[candidate_idx];
+                const float* candidateBox = &boxesPtr[candidate.second * 4];
+                if (selectedBoxes.anyIouAtLeast(candidateBox, 0, m_iouThreshold))
+                    continue;
+
+                m_filtBoxes[offset + selectedBoxes.size()] = filteredBoxes(candidate.first, batch_idx, class_idx, candidate.second);
+                selectedBoxes.push(candidateBox);
             }
-            m_numFiltBox[batch_idx][class_idx] = io_selection_size;
+            m_numFiltBox[batch_idx][class_idx] = selectedBoxes.size();
         }
     });
 }
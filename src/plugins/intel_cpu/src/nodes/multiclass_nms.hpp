@@ -81,19 +81,11 @@ private:
             : score(_score), batch_index(_batch_index), class_index(_class_index), box_index(_box_index) {}
     };
 
-    struct boxInfo {
-        float score;
-        int idx;
-        int suppress_begin_index;
-    };
-
     std::vector<filteredBoxes> m_filtBoxes; // rois after nms for each class in each image
 
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
-    float intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized);
-
     void nmsWithEta(const float* boxes, const float* scores, const int* roisnum, const InferenceEngine::SizeVector& boxesStrides,
                     const InferenceEngine::SizeVector& scoresStrides, const InferenceEngine::SizeVector& roisnumStrides, const bool shared);
 
@@ -11,6 +11,7 @@
 
 #include "non_max_suppression.h"
 #include "ie_parallel.hpp"
+#include "common/nms_utils.h"
 #include <ngraph/opsets/opset5.hpp>
 #include <ov_ops/nms_ie_internal.hpp>
 #include "utils/general_utils.h"
@@ -888,18 +889,33 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);  // score, box_id, suppress_begin_index
-        for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
-            if (scoresPtr[box_idx] > scoreThreshold)
-                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-        }
-        size_t sortedBoxSize = sorted_boxes.size();
+        // the candidates are merged with the boxes which scores are updated, in the same order as a single queue of all
+        // the boxes, but only the updated boxes are in the queue and the candidates are sorted only as far as needed
+        NmsSortedCandidates candidates;
+        candidates.reset(scoresPtr, numBoxes, scoreThreshold, false);
+        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> updated_boxes(less);  // score, box_id, suppress_begin_index
+        size_t next_candidate = 0;
+        auto has_boxes = [&]() {
+            return next_candidate < candidates.size() || !updated_boxes.empty();
+        };
+        auto pop_box = [&]() -> boxInfo {
+            if (!updated_boxes.empty() && (next_candidate == candidates.size() ||
+                    less(boxInfo({candidates[next_candidate].first, candidates[next_candidate].second, 0}), updated_boxes.top()))) {
+                boxInfo box = updated_boxes.top();
+                updated_boxes.pop();
+                return box;
+            }
+            const auto& candidate = candidates[next_candidate++];
+            return boxInfo({candidate.first, candidate.second, 0});
+        };
+
+        size_t sortedBoxSize = candidates.size();
         size_t maxSeletedBoxNum = std::min(sortedBoxSize, maxOutputBoxesPerClass);
         selectedBoxes.reserve(maxSeletedBoxNum);
         if (maxSeletedBoxNum > 0) {
+            candidates.sortUpTo(maxSeletedBoxNum);
             // include first directly
-            boxInfo candidateBox = sorted_boxes.top();
-            sorted_boxes.pop();
+            boxInfo candidateBox = pop_box();
             selectedBoxes.push_back({ candidateBox.score, batch_idx, class_idx, candidateBox.idx });
             if (maxSeletedBoxNum > 1) {
                 if (nms_kernel) {
@@ -917,10 +933,9 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
                     arg.iou_threshold = static_cast<float*>(&iouThreshold);
                     arg.score_threshold = static_cast<float*>(&scoreThreshold);
                     arg.scale = static_cast<float*>(&scale);
-                    while (selectedBoxes.size() < maxOutputBoxesPerClass && !sorted_boxes.empty()) {
-                        boxInfo candidateBox = sorted_boxes.top();
+                    while (selectedBoxes.size() < maxOutputBoxesPerClass && has_boxes()) {
+                        boxInfo candidateBox = pop_box();
                         float origScore = candidateBox.score;
-                        sorted_boxes.pop();
 
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected, 2 for updated
                         arg.score = static_cast<float*>(&candidateBox.score);
@@ -945,15 +960,14 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
                                 boxCoord3[selectedSize - 1] = boxesPtr[candidateBox.idx * 4 + 3];
                             } else {
                                 candidateBox.suppress_begin_index = selectedBoxes.size();
-                                sorted_boxes.push(candidateBox);
+                                updated_boxes.push(candidateBox);
                             }
                         }
                     }
                 } else {
-                    while (selectedBoxes.size() < maxOutputBoxesPerClass && !sorted_boxes.empty()) {
-                        boxInfo candidateBox = sorted_boxes.top();
+                    while (selectedBoxes.size() < maxOutputBoxesPerClass && has_boxes()) {
+                        boxInfo candidateBox = pop_box();
                         float origScore = candidateBox.score;
-                        sorted_boxes.pop();
 
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected, 2 for updated
                         for (int selected_idx = static_cast<int>(selectedBoxes.size()) - 1; selected_idx >= candidateBox.suppress_begin_index; selected_idx--) {
@@ -975,7 +989,7 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
                                 selectedBoxes.push_back({ candidateBox.score, batch_idx, class_idx, candidateBox.idx });
                             } else {
                                 candidateBox.suppress_begin_index = selectedBoxes.size();
-                                sorted_boxes.push(candidateBox);
+                                updated_boxes.push(candidateBox);
                             }
                         }
                     }
@@ -997,28 +1011,25 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
-        for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
-            if (scoresPtr[box_idx] > scoreThreshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
+        // the candidates past the first max_out_box ones are sorted only if the boxes before them are suppressed
+        NmsSortedCandidates sorted_boxes;  // score, box_idx
+        sorted_boxes.reset(scoresPtr, numBoxes, scoreThreshold, false);
 
         int io_selection_size = 0;
         size_t sortedBoxSize = sorted_boxes.size();
         if (sortedBoxSize > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
+            sorted_boxes.sortUpTo(maxOutputBoxesPerClass);
             int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
             filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
             io_selection_size++;
             if (sortedBoxSize > 1) {
                 if (nms_kernel) {
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0f);
+                    // no more than max_out_box boxes are selected
+                    const size_t maxSelectedBoxNum = std::min(sortedBoxSize, maxOutputBoxesPerClass);
+                    std::vector<float> boxCoord0(maxSelectedBoxNum, 0.0f);
+                    std::vector<float> boxCoord1(maxSelectedBoxNum, 0.0f);
+                    std::vector<float> boxCoord2(maxSelectedBoxNum, 0.0f);
+                    std::vector<float> boxCoord3(maxSelectedBoxNum, 0.0f);
 
                     boxCoord0[0] = boxesPtr[sorted_boxes[0].second * 4];
                     boxCoord1[0] = boxesPtr[sorted_boxes[0].second * 4 + 1];
@@ -10,6 +10,12 @@
 #include <algorithm>
 #include <array>
 #include <tuple>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 
 #include <dnnl_debug.h>
 #include <onednn/dnnl.h>
@@ -18,7 +24,10 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/pass/visualize_tree.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/runtime/aligned_buffer.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <common/primitive_hashing_utils.hpp>
 
 #include <snippets/op/subgraph.hpp>
 #include "emitters/cpu_generator.hpp"
@@ -35,7 +44,236 @@ using namespace Xbyak;
 namespace ov {
 namespace intel_cpu {
 namespace node {
+namespace {
+
+/**
+ * Serializes the snippet body to a canonical form which doesn't depend on node names, so structurally identical
+ * subgraphs (e.g. the same MHA block repeated in every transformer layer) get the same value.
+ * The values are written as their bytes, so e.g. -0.0f and 0.0f differ, the strings and the sequences are
+ * prefixed with their size, so different bodies never produce the same serialization.
+ * Attributes of unknown types can't be serialized, such bodies are reported as not cacheable.
+ */
+class SnippetBodySerializer : public ov::AttributeVisitor {
+public:
+    void serialize_model(const std::shared_ptr<const ov::Model>& model) {
+        const auto ops = model->get_ordered_ops();
+        std::unordered_map<const ov::Node*, size_t> opIndex;
+        write(ops.size());
+        for (const auto& op : ops) {
+            opIndex.emplace(op.get(), opIndex.size());
+            write(std::string(op->get_type_info().name));
+            write(std::string(op->get_type_info().version_id ? op->get_type_info().version_id : ""));
+            write(op->get_input_size());
+            for (const auto& input : op->inputs()) {
+                const auto& source = input.get_source_output();
+                write(opIndex.at(source.get_node()));
+                write(source.get_index());
+                serialize_rt_info(input.get_rt_info());
+            }
+            write(op->get_output_size());
+            for (const auto& output : op->outputs()) {
+                write(output.get_element_type().to_string());
+                write(output.get_partial_shape().to_string());
+                serialize_rt_info(output.get_rt_info());
+                serialize_rt_info(output.get_tensor().get_rt_info());
+            }
+            serialize_rt_info(op->get_rt_info());
+            op->visit_attributes(*this);
+        }
+    }
+
+    const std::string& get() const { return m_body; }
+    bool is_complete() const { return m_complete; }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        using BufferAdapter = ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+        write(name);
+        if (auto a = ov::as_type<BufferAdapter>(&adapter)) {
+            const auto& buffer = a->get();
+            write(buffer->size());
+            m_body.append(static_cast<const char*>(buffer->get_ptr()), buffer->size());
+        } else {
+            m_complete = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override { write(name, adapter.get()); }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        write(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        write(name);
+        serialize_model(adapter.get());
+    }
+
+private:
+    template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, bool>::type = true>
+    void write(const T& value) {
+        m_body.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void write(const std::string& value) {
+        write(value.size());
+        m_body.append(value);
+    }
+
+    template <typename T>
+    void write(const std::vector<T>& value) {
+        write(value.size());
+        for (const auto& item : value)
+            write(item);
+    }
+
+    template <typename T>
+    void write(const std::string& name, const T& value) {
+        write(name);
+        write(value);
+    }
+
+    void serialize_rt_info(const ov::RTMap& rt) {
+        for (const auto& item : rt) {
+            // names of the fused layers don't affect generated code
+            if (item.first == "originalLayersNames" || item.first == std::string(ov::FusedNames::get_type_info_static()))
+                continue;
+            try {
+                std::stringstream strm;
+                item.second.print(strm);
+                write(item.first, strm.str());
+            } catch (const ov::Exception&) {
+                m_complete = false;
+            }
+        }
+    }
+
+    std::string m_body;
+    bool m_complete = true;
+};
+
+struct SnippetKey {
+    // canonical serialization of the body, compared as a whole so the bodies with the same hash aren't mixed up
+    std::string body;
+    std::vector<VectorDims> inputShapes;
+    std::vector<VectorDims> outputShapes;
+    VectorDims masterShape;
+    std::vector<Precision> inputPrecisions;
+    std::vector<Precision> outputPrecisions;
+    size_t tileRank;
+    cpu_isa_t isa;
+
+    size_t hash() const {
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = std::hash<std::string>()(body);
+        for (const auto& shape : inputShapes)
+            seed = get_vector_hash(seed, shape);
+        for (const auto& shape : outputShapes)
+            seed = get_vector_hash(seed, shape);
+        seed = get_vector_hash(seed, masterShape);
+        for (const auto& prc : inputPrecisions)
+            seed = hash_combine(seed, prc.getPrecVal());
+        for (const auto& prc : outputPrecisions)
+            seed = hash_combine(seed, prc.getPrecVal());
+        seed = hash_combine(seed, tileRank);
+        seed = hash_combine(seed, isa);
+        return seed;
+    }
+
+    bool operator==(const SnippetKey& rhs) const {
+        return body == rhs.body &&
+               inputShapes == rhs.inputShapes &&
+               outputShapes == rhs.outputShapes &&
+               masterShape == rhs.masterShape &&
+               inputPrecisions == rhs.inputPrecisions &&
+               outputPrecisions == rhs.outputPrecisions &&
+               tileRank == rhs.tileRank &&
+               isa == rhs.isa;
+    }
+};
+
+/**
+ * Process wide store of generated snippet kernels.
+ * The store doesn't own kernels: an entry lives while at least one Snippet node uses it,
+ * so code memory is released together with the last compiled model using it.
+ *
+ * Is a thread safe
+ */
+class SnippetKernelCache {
+    struct KernelInfo {
+        std::mutex guard;
+        std::weak_ptr<SnippetKernel> kernel;
+    };
+
+    struct KeyHasher {
+        size_t operator()(const SnippetKey& key) const {
+            return key.hash();
+        }
+    };
+
+public:
+    static SnippetKernelCache& getInstance() {
+        static SnippetKernelCache cache;
+        return cache;
+    }
 
+    std::shared_ptr<SnippetKernel> findOrCreate(const SnippetKey& key, const std::function<std::shared_ptr<SnippetKernel>()>& create) {
+        std::shared_ptr<KernelInfo> info;
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            auto found = kernels.find(key);
+            if (found == kernels.end()) {
+                // drop the entries which are neither used by nodes nor being generated right now
+                for (auto it = kernels.begin(); it != kernels.end();) {
+                    if (it->second.use_count() == 1 && it->second->kernel.expired())
+                        it = kernels.erase(it);
+                    else
+                        ++it;
+                }
+                found = kernels.emplace(key, std::make_shared<KernelInfo>()).first;
+            }
+            info = found->second;
+        }
+
+        // the same kernel requested concurrently by another stream is generated only once
+        std::lock_guard<std::mutex> lock(info->guard);
+        auto kernel = info->kernel.lock();
+        if (!kernel) {
+            kernel = create();
+            info->kernel = kernel;
+        }
+        return kernel;
+    }
+
+    // the number of kernels used by the nodes
+    size_t size() {
+        std::lock_guard<std::mutex> lock(guard);
+        size_t alive = 0;
+        for (const auto& entry : kernels) {
+            std::lock_guard<std::mutex> kernelLock(entry.second->guard);
+            if (!entry.second->kernel.expired())
+                alive++;
+        }
+        return alive;
+    }
+
+private:
+    std::mutex guard;
+    std::unordered_map<SnippetKey, std::shared_ptr<KernelInfo>, KeyHasher> kernels;
+};
+
+}   // namespace
+
+size_t Snippet::sharedKernelsCount() {
+    return SnippetKernelCache::getInstance().size();
+}
 
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
         : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
@@ -343,8 +581,31 @@ void Snippet::createPrimitive() {
     prepareParams();
     jcp.master_shape = masterShape;
     jcp.tile_rank = tileRank;
-    generate(&jcp);
-    buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
+
+    auto generateKernel = [&]() {
+        generate(&jcp);
+        auto generated = std::make_shared<SnippetKernel>();
+        generated->owner = snippet;
+        generated->schedule = schedule;
+        generated->buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
+        return generated;
+    };
+
+    // canonicalized body already reflects input/output layouts and precisions
+    SnippetBodySerializer bodySerializer;
+    bodySerializer.serialize_model(snippet->body_ptr());
+    if (bodySerializer.is_complete()) {
+        SnippetKey key{bodySerializer.get(), normInputShapes, normOutputShapes, masterShape, {}, {}, tileRank, host_isa};
+        for (size_t i = 0; i < inputShapes.size(); i++)
+            key.inputPrecisions.push_back(config.inConfs[i].getMemDesc()->getPrecision());
+        for (size_t i = 0; i < outputShapes.size(); i++)
+            key.outputPrecisions.push_back(config.outConfs[i].getMemDesc()->getPrecision());
+        kernel = SnippetKernelCache::getInstance().findOrCreate(key, generateKernel);
+    } else {
+        kernel = generateKernel();
+    }
+    schedule = kernel->schedule;
+    buffer_scratchpad_size = kernel->buffer_scratchpad_size;
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
 }
 
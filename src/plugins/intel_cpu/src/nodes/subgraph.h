@@ -19,6 +19,14 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+/// Generated snippet code together with the subgraph copy owning it.
+/// Shared between all Snippet nodes (of all graphs/streams) with the same canonical body, shapes, precisions and ISA
+struct SnippetKernel {
+    std::shared_ptr<ngraph::snippets::op::Subgraph> owner;
+    ngraph::snippets::Schedule schedule;
+    size_t buffer_scratchpad_size = 0;
+};
+
 /// Snippet represents subgraph node in CPU plugin
 /// potentially, snippet can be placed as a postop to any support operation while it doesn't support postops itself
 /// precision: fp32
@@ -48,6 +56,9 @@ public:
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
 
+    // number of the generated kernels currently shared by the Snippet nodes of the process
+    static size_t sharedKernelsCount();
+
 private:
     static const size_t rank6D {6};
 
@@ -75,6 +86,8 @@ private:
 
     // Holds generated snippet with information about how to schedule it
     ngraph::snippets::Schedule schedule;
+    // Keeps the (possibly shared) generated code alive while the node uses it
+    std::shared_ptr<SnippetKernel> kernel;
 
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
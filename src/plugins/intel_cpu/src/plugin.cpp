@@ -532,6 +532,7 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
             METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
             METRIC_KEY(RANGE_FOR_STREAMS),
             METRIC_KEY(IMPORT_EXPORT_SUPPORT),
+            ov::internal_supported_properties.name(),
         };
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
@@ -569,6 +570,12 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
 }
 
 Parameter Engine::GetMetric(const std::string& name, const std::map<std::string, Parameter>& options) const {
+    // the internal properties aren't reported among the supported metrics and properties
+    if (name == ov::internal_supported_properties) {
+        return decltype(ov::internal_supported_properties)::value_type{
+            ov::PropertyName(PluginConfigInternalParams::KEY_CACHED_BLOB_PATH, ov::PropertyMutability::RW)};
+    }
+
     if (isLegacyAPI())
         return GetMetricLegacy(name, options);
 
@@ -587,6 +594,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RO_property(ov::device::full_name.name()),
                                                     RO_property(ov::device::capabilities.name()),
                                                     RO_property(ov::caching_properties.name()),
+                                                    RO_property(ov::internal_supported_properties.name()),
                                                     RO_property(ov::cache_dir.name())   // WA Can be removed after implementing snippet serialization.
         };
         // the whole config is RW before network is loaded.
@@ -705,16 +713,19 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
                                             const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "ImportNetwork");
 
+    Config conf = engConfig;
+    conf.readProperties(config);
+
     CNNNetworkDeserializer deserializer(networkModel,
         [this](const std::string& model, const Blob::CPtr& weights) {
             return GetCore()->ReadNetwork(model, weights, true);
-        });
+        }, conf.cachedBlobPath);
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
-
-    Config conf = engConfig;
-    conf.readProperties(config);
+    // the section with the compiled constants follows the network, its data is read from the stream by the graphs
+    // compiled in the constructor of the network below
+    const auto compiledConstants = CompiledConstants::read(networkModel);
 
     // import config props from caching model
     auto function = cnnnetwork.getFunction();
@@ -736,7 +747,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(),
+                                                     compiledConstants);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
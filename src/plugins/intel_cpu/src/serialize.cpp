@@ -7,6 +7,10 @@
 
 #include <pugixml.hpp>
 
+#include <cstring>
+
+#include "openvino/util/mmap_object.hpp"
+
 using namespace InferenceEngine;
 
 namespace ov {
@@ -41,6 +45,54 @@ namespace {
         IE_THROW(NetworkNotRead) << "Unknown layout with name '" << name << "'";
     }
 
+    // the weights of the exported network start at the page boundary of the file, so the import can map them
+    constexpr size_t weightsAlignment = 4096;
+
+    // the allocator of the blob over the memory mapped file, keeps the mapping alive as long as the blob
+    class MappedMemoryAllocator : public InferenceEngine::IAllocator {
+    public:
+        MappedMemoryAllocator(std::shared_ptr<ov::util::MappedMemory> mapping, size_t offset)
+            : _mapping(std::move(mapping)), _offset(offset) {}
+
+        void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+            return handle;
+        }
+        void unlock(void*) noexcept override {}
+        void* alloc(size_t size) noexcept override {
+            return _offset + size <= _mapping->size() ? _mapping->data() + _offset : nullptr;
+        }
+        bool free(void*) noexcept override {
+            return true;
+        }
+
+    private:
+        std::shared_ptr<ov::util::MappedMemory> _mapping;
+        size_t _offset;
+    };
+
+    // maps the weights from the file the stream reads, returns nullptr if the file doesn't match the stream
+    InferenceEngine::Blob::Ptr mapWeights(const std::string& path,
+                                          std::streamoff headerOffset,
+                                          const ov::pass::StreamSerialize::DataHeader& hdr) {
+        std::shared_ptr<ov::util::MappedMemory> mapping;
+        try {
+            mapping = ov::util::load_mmap_object(path);
+        } catch (const std::exception&) {
+            return nullptr;
+        }
+        const auto size = mapping->size();
+        if (headerOffset < 0 || static_cast<size_t>(headerOffset) + sizeof hdr > size ||
+            std::memcmp(mapping->data() + headerOffset, &hdr, sizeof hdr) != 0 ||
+            hdr.consts_offset + hdr.consts_size > size) {
+            return nullptr;
+        }
+        auto dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C),
+            std::make_shared<MappedMemoryAllocator>(std::move(mapping), hdr.consts_offset));
+        dataBlob->allocate();
+        return dataBlob;
+    }
+
     template <typename T>
     void setInfo(pugi::xml_object_range<pugi::xml_named_node_iterator>&& nodes, T&& info) {
         auto nodes_it = nodes.begin();
@@ -110,6 +162,13 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
         }
 
         xml_doc.save(stream);
+
+        // the weights follow the custom data, the trailing spaces align them to the page
+        const auto pos = stream.tellp();
+        if (pos != std::ostream::pos_type(-1)) {
+            const auto padding = (weightsAlignment - static_cast<size_t>(pos) % weightsAlignment) % weightsAlignment;
+            stream << std::string(padding, ' ');
+        }
     };
 
     // Serialize to old representation in case of old API
@@ -119,9 +178,10 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
 }
 
-CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn, std::string blobPath)
     : _istream(istream)
-    , _cnn_network_builder(fn) {
+    , _cnn_network_builder(fn)
+    , _blobPath(std::move(blobPath)) {
 }
 
 void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network) {
@@ -130,6 +190,7 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     std::string xmlString, xmlInOutString;
     InferenceEngine::Blob::Ptr dataBlob;
 
+    const std::streamoff headerOffset = _istream.tellg();
     StreamSerialize::DataHeader hdr = {};
     _istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
 
@@ -143,9 +204,12 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
         IE_THROW(NetworkNotRead) << "The inputs and outputs information is invalid.";
     }
 
-    // read blob content
-    _istream.seekg(hdr.consts_offset);
-    if (hdr.consts_size) {
+    // map or read blob content, the mapped constants share the pages of the file with other processes
+    if (hdr.consts_size && !_blobPath.empty()) {
+        dataBlob = mapWeights(_blobPath, headerOffset, hdr);
+    }
+    if (hdr.consts_size && !dataBlob) {
+        _istream.seekg(hdr.consts_offset);
         dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
             InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
         dataBlob->allocate();
@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <functional>
+#include <string>
 #include <cpp/ie_cnn_network.h>
 
 namespace ov {
@@ -27,12 +28,17 @@ public:
                 InferenceEngine::CNNNetwork(
                         const std::string&,
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
-    CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
+    /**
+     * @param blobPath path to the file the stream reads (if known), the weights are mapped from the file instead of
+     *        being read into the memory
+     */
+    CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn, std::string blobPath = {});
     void operator >> (InferenceEngine::CNNNetwork & network);
 
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::string _blobPath;
 };
 
 // const std::string& model, const Blob::CPtr& weights
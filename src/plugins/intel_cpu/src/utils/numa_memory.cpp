@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+
+namespace {
+// the values from linux/mempolicy.h, the libnuma headers are not required
+constexpr int mpolPreferred = 1;
+
+size_t pageSize() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+}   // namespace
+
+void* allocateOnNumaNode(size_t size, int numaNodeId) {
+    if (size == 0 || numaNodeId < 0)
+        return nullptr;
+    const size_t page = pageSize();
+    const size_t mappedSize = (size + page - 1) / page * page;
+    void* data = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    constexpr size_t bitsPerWord = sizeof(unsigned long) * 8;  // NOLINT
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerWord + 1, 0);  // NOLINT
+    nodeMask[numaNodeId / bitsPerWord] = 1ul << (numaNodeId % bitsPerWord);
+    // the kernel expects the number of the mask bits plus one
+    const unsigned long maxNode = nodeMask.size() * bitsPerWord + 1;  // NOLINT
+    // no page is touched yet, so nothing is moved
+    if (syscall(SYS_mbind, data, mappedSize, mpolPreferred, nodeMask.data(), maxNode, 0) != 0) {
+        munmap(data, mappedSize);
+        return nullptr;
+    }
+    return data;
+}
+
+void freeOnNumaNode(void* data, size_t size) {
+    if (data == nullptr)
+        return;
+    const size_t page = pageSize();
+    munmap(data, (size + page - 1) / page * page);
+}
+
+bool getNumaNodesBytes(const void* data, size_t size, std::map<int, uint64_t>& bytes) {
+    if (data == nullptr || size == 0)
+        return true;
+    const size_t page = pageSize();
+    const auto dataBegin = reinterpret_cast<uintptr_t>(data);
+    const auto dataEnd = dataBegin + size;
+    const auto firstPage = dataBegin / page * page;
+
+    constexpr size_t batch = 1024;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    std::map<int, uint64_t> counted;
+    for (auto batchBegin = firstPage; batchBegin < dataEnd; batchBegin += batch * page) {
+        pages.clear();
+        for (auto p = batchBegin; p < dataEnd && pages.size() < batch; p += page)
+            pages.push_back(reinterpret_cast<void*>(p));
+        status.assign(pages.size(), -1);
+        // with no target nodes the call only reports the node of every page
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0)
+            return false;
+        for (size_t i = 0; i < pages.size(); i++) {
+            // negative status means the page is not allocated yet
+            if (status[i] < 0)
+                continue;
+            const auto p = reinterpret_cast<uintptr_t>(pages[i]);
+            counted[status[i]] += std::min(p + page, dataEnd) - std::max(p, dataBegin);
+        }
+    }
+    for (const auto& node : counted)
+        bytes[node.first] += node.second;
+    return true;
+}
+
+#else
+
+void* allocateOnNumaNode(size_t, int) {
+    return nullptr;
+}
+
+void freeOnNumaNode(void*, size_t) {}
+
+bool getNumaNodesBytes(const void*, size_t, std::map<int, uint64_t>&) {
+    return false;
+}
+
+#endif
+
+}   // namespace intel_cpu
+}   // namespace ov
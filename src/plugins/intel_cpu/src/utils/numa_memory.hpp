@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Placement of the memory pages on the NUMA nodes
+ * @file numa_memory.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Allocates the memory in a dedicated anonymous mapping with the NUMA node preferred for its pages, so the pages
+ *        are allocated on the node on the first touch by any thread. The policy belongs to the mapping and is gone
+ *        with it, no other allocation is affected.
+ * @param size the memory size in bytes
+ * @param numaNodeId the OS id of the NUMA node
+ * @return the page aligned memory to be released by freeOnNumaNode, or nullptr if the placement isn't supported
+ *         (Linux only) or failed
+ */
+void* allocateOnNumaNode(size_t size, int numaNodeId);
+
+/**
+ * @brief Releases the memory allocated by allocateOnNumaNode
+ * @param data the memory
+ * @param size the size passed to allocateOnNumaNode
+ */
+void freeOnNumaNode(void* data, size_t size);
+
+/**
+ * @brief Adds the bytes of the memory resident on every NUMA node to the map, the pages not touched yet aren't counted
+ * @param data the memory
+ * @param size the memory size in bytes
+ * @param bytes the bytes per the NUMA node OS id
+ * @return false if the placement of the pages can't be queried (the map isn't changed then)
+ */
+bool getNumaNodesBytes(const void* data, size_t size, std::map<int, uint64_t>& bytes);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -5,11 +5,119 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+constexpr uint64_t P1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t P3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t P5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t accumulate(uint64_t acc, uint64_t input) {
+    acc += input * P2;
+    acc = rotl(acc, 31);
+    return acc * P1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+    acc ^= accumulate(0, val);
+    return acc * P1 + P4;
+}
+}  // namespace
+
+constexpr size_t SimpleDataHash::kChunkSize;
+
+uint64_t SimpleDataHash::hashChunk(const unsigned char* data, size_t size, uint64_t seed) {
+    const unsigned char* p = data;
+    const unsigned char* const end = data + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        // four independent lanes keep the multipliers busy
+        uint64_t v1 = seed + P1 + P2;
+        uint64_t v2 = seed + P2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - P1;
+        const unsigned char* const limit = end - 32;
+        do {
+            v1 = accumulate(v1, read64(p));
+            v2 = accumulate(v2, read64(p + 8));
+            v3 = accumulate(v3, read64(p + 16));
+            v4 = accumulate(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + P5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= accumulate(0, read64(p));
+        h = rotl(h, 27) * P1 + P4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * P1;
+        h = rotl(h, 23) * P2 + P3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= (*p) * P5;
+        h = rotl(h, 11) * P1;
+    }
+
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size, uint64_t seed) const {
+    if (size <= kChunkSize)
+        return hashChunk(data, size, seed);
+
+    const size_t chunksNum = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> digests(chunksNum);
+    InferenceEngine::parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        digests[i] = hashChunk(data + offset, std::min(kChunkSize, size - offset), seed);
+    });
+
+    return hashChunk(reinterpret_cast<const unsigned char*>(digests.data()), chunksNum * sizeof(uint64_t), size + seed);
+}
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
 WeightsSharing::SharedMemory::SharedMemory(
@@ -71,6 +179,69 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+PackedWeightsStore& PackedWeightsStore::getInstance() {
+    static PackedWeightsStore store;
+    return store;
+}
+
+std::string PackedWeightsStore::makeKey(const void* srcData, size_t srcSize, const MemoryDesc& srcDesc,
+                                       const MemoryDesc& packedDesc, int numaNodeId) {
+    // two 64-bit hashes with the different seeds make the collision of the different weights negligible
+    constexpr uint64_t secondSeed = 0x9E3779B97F4A7C15ULL;
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    const auto data = static_cast<const unsigned char*>(srcData);
+    return std::to_string(hashFunc.hash(data, srcSize))
+           + "_" + std::to_string(hashFunc.hash(data, srcSize, secondSeed))
+           + "_" + std::to_string(srcSize)
+           + "_" + srcDesc.getPrecision().name()
+           + "_" + srcDesc.getShape().toString()
+           + "_" + srcDesc.serializeFormat()
+           + "_" + packedDesc.getPrecision().name()
+           + "_" + packedDesc.getShape().toString()
+           + "_" + packedDesc.serializeFormat()
+           + "_" + std::to_string(numaNodeId);
+}
+
+MemoryPtr PackedWeightsStore::findOrCreate(const std::string& key, const std::function<MemoryPtr(void)>& create) {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = packedWeights.find(key);
+        if (found != packedWeights.end()) {
+            if (auto ptr = found->second.lock())
+                return ptr;
+        }
+    }
+
+    auto newPtr = create();
+
+    std::lock_guard<std::mutex> lock(guard);
+    auto& stored = packedWeights[key];
+    if (auto ptr = stored.lock())
+        return ptr;
+    stored = newPtr;
+    if (packedWeights.size() >= expiredCheckThreshold) {
+        removeExpired();
+        expiredCheckThreshold = std::max<size_t>(64, 2 * packedWeights.size());
+    }
+    return newPtr;
+}
+
+size_t PackedWeightsStore::size() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return std::count_if(packedWeights.begin(), packedWeights.end(), [](const decltype(packedWeights)::value_type& it) {
+        return !it.second.expired();
+    });
+}
+
+void PackedWeightsStore::removeExpired() {
+    for (auto it = packedWeights.begin(); it != packedWeights.end();) {
+        if (it->second.expired())
+            it = packedWeights.erase(it);
+        else
+            ++it;
+    }
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<WeightsSharing>();
@@ -23,28 +23,20 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * 64-bit non-cryptographic hash of the weights content (xxHash64 class algorithm).
+ * Buffers larger than kChunkSize are split into fixed size chunks which are hashed in parallel,
+ * then the chunk digests are hashed together. The chunk size doesn't depend on the number of threads,
+ * so the same data always produces the same value.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    uint64_t hash(const unsigned char* data, size_t size, uint64_t seed = 0) const;
+
+    static constexpr size_t kChunkSize = 1 << 20;  // 1 MB
 
 protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static uint64_t hashChunk(const unsigned char* data, size_t size, uint64_t seed);
 };
 
 /**
@@ -102,6 +94,40 @@ protected:
     static const SimpleDataHash simpleCRC;
 };
 
+/**
+ * Process-wide content addressed store of the packed (reordered) weights
+ * The key of an entry is built from the content hash of the source weights and the packed memory descriptor,
+ * so the compiled models with the same weights (e.g. the variants of a model compiled for different shapes)
+ * share the packed weights regardless of the node names and the addresses of the source constants.
+ * The store doesn't own the memory, an entry expires once the last graph using the packed weights is released.
+ *
+ * Is a thread safe
+ */
+class PackedWeightsStore {
+public:
+    static PackedWeightsStore& getInstance();
+
+    static std::string makeKey(const void* srcData, size_t srcSize, const MemoryDesc& srcDesc,
+                               const MemoryDesc& packedDesc, int numaNodeId);
+
+    /**
+     * Returns the packed weights stored with the key or stores the ones returned by create.
+     * The packing is done outside of the store lock, if several threads pack the same weights concurrently
+     * all of them get the copy stored first.
+     */
+    MemoryPtr findOrCreate(const std::string& key, const std::function<MemoryPtr(void)>& create);
+
+    // number of the alive entries
+    size_t size() const;
+
+private:
+    void removeExpired();
+
+    mutable std::mutex guard;
+    std::unordered_map<std::string, std::weak_ptr<Memory>> packedWeights;
+    size_t expiredCheckThreshold = 64;
+};
+
 /**
  * Collection of memory caching store per NUMA node(former socket)
  *
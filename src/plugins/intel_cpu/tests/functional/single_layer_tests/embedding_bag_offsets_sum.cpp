@@ -74,7 +74,14 @@ public:
         size_t defaultIndex;
         std::tie(inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // the BF16 table of the known row size is gathered as is by the kernel, otherwise it's converted to FP32
+        const auto tablePrecision =
+            inType == ElementType::bf16 && (!InferenceEngine::with_cpu_x86_avx512_core() || inputShapes.first.is_dynamic()) ?
+            ElementType::f32 : inType;
+        selectedType = makeSelectedTypeStr("ref", tablePrecision);
+        // the BF16 rows are accumulated in FP32
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2f;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -163,5 +170,56 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagOffsetsSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+// the shapes of the gathering kernel: the tails of the vectors and the rows wider than one block of the registers
+const std::vector<InputShape> kernel_input_shapes = {
+        {{20, 3}, {{20, 3}}},
+        {{20, 37}, {{20, 37}}},
+        {{20, 300}, {{20, 300}}},
+        {{20, 5, 61}, {{20, 5, 61}}},
+        {
+            // input model dynamic shapes
+            {ov::Dimension::dynamic(), ov::Dimension::dynamic()},
+            // input tensor shapes
+            {{20, 300}, {20, 37}, {20, 300}}
+        },
+};
+
+// the empty bags, the bags of one row and the bags with the repeated rows
+const std::vector<std::vector<size_t>> kernel_indices = {{0, 19, 2, 2, 2, 7, 13, 19}};
+const std::vector<std::vector<size_t>> kernel_offsets = {{0, 0, 2, 3, 3, 7}, {0, 1, 2, 3, 4, 5, 6, 7}};
+const std::vector<size_t> kernel_default_index = {19};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Kernel, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(kernel_input_shapes),
+                        ::testing::ValuesIn(kernel_indices),
+                        ::testing::ValuesIn(kernel_offsets),
+                        ::testing::ValuesIn(kernel_default_index),
+                        ::testing::ValuesIn(with_weights),
+                        ::testing::ValuesIn(with_default_index)),
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
+
+// the indices are validated before the rows are gathered
+TEST(EmbeddingBagOffsetsSumCPUTest, smoke_IndexOutOfRange) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t rows = 20;
+    auto table = std::make_shared<ngraph::opset1::Parameter>(ElementType::f32, ov::Shape{rows, 37});
+    auto embBag = ngraph::builder::makeEmbeddingBagOffsetsSum(
+        ElementType::f32, ElementType::i32, table, {0, 1, rows, 2}, {0, 2}, 0, true, false);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{embBag}, ov::ParameterVector{table});
+
+    ov::Core core;
+    auto inferRequest = core.compile_model(model, CommonTestUtils::DEVICE_CPU).create_infer_request();
+    ov::Tensor input(ElementType::f32, {rows, 37});
+    std::fill_n(input.data<float>(), input.get_size(), 1.f);
+    inferRequest.set_input_tensor(input);
+    ASSERT_THROW(inferRequest.infer(), ov::Exception);
+}
 }  // namespace CPULayerTestsDefinitions
@@ -67,7 +67,14 @@ protected:
         bool withWeights;
         std::tie(inputShapes, indices, withWeights) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // the BF16 table of the known row size is gathered as is by the kernel, otherwise it's converted to FP32
+        const auto tablePrecision =
+            inType == ElementType::bf16 && (!InferenceEngine::with_cpu_x86_avx512_core() || inputShapes.first.is_dynamic()) ?
+            ElementType::f32 : inType;
+        selectedType = makeSelectedTypeStr("ref", tablePrecision);
+        // the BF16 rows are accumulated in FP32
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2f;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -147,5 +154,26 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagPackedSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+// the shapes of the gathering kernel: the tails of the vectors and the rows wider than one block of the registers
+const std::vector<InputShape> kernel_input_shapes = {
+        {{20, 3}, {{20, 3}}},
+        {{20, 37}, {{20, 37}}},
+        {{20, 300}, {{20, 300}}},
+        {{20, 5, 61}, {{20, 5, 61}}},
+};
+
+const std::vector<std::vector<std::vector<size_t>>> kernel_indices = {{{0, 19, 7}, {2, 2, 2}, {13, 19, 0}}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Kernel, EmbeddingBagPackedSumLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(kernel_input_shapes),
+                        ::testing::ValuesIn(kernel_indices),
+                        ::testing::ValuesIn(with_weights)),
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -77,7 +77,14 @@ protected:
         size_t numSegments, defaultIndex;
         std::tie(inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // the BF16 table of the known row size is gathered as is by the kernel, otherwise it's converted to FP32
+        const auto tablePrecision =
+            inType == ElementType::bf16 && (!InferenceEngine::with_cpu_x86_avx512_core() || inputShapes.first.is_dynamic()) ?
+            ElementType::f32 : inType;
+        selectedType = makeSelectedTypeStr("ref", tablePrecision);
+        // the BF16 rows are accumulated in FP32
+        if (inType == ElementType::bf16)
+            rel_threshold = 1e-2f;
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -168,5 +175,34 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingSegmentsSumLayerCPUTest,
          ::testing::ValuesIn(indPrecisions),
          ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+// the shapes of the gathering kernel: the tails of the vectors and the rows wider than one block of the registers
+const std::vector<InputShape> kernel_input_shapes = {
+    {{20, 3}, {{20, 3}}},
+    {{20, 37}, {{20, 37}}},
+    {{20, 300}, {{20, 300}}},
+    {{20, 5, 61}, {{20, 5, 61}}},
+};
+
+// the segments 1, 3 and 5 are empty
+const std::vector<std::vector<size_t>> kernel_indices = {{0, 19, 2, 2, 2, 7, 13, 19}};
+const std::vector<std::vector<size_t>> kernel_segment_ids = {{0, 0, 2, 2, 2, 4, 4, 6}};
+const std::vector<size_t> kernel_num_segments = {7};
+const std::vector<size_t> kernel_default_index = {19};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Kernel, EmbeddingSegmentsSumLayerCPUTest,
+     ::testing::Combine(
+         ::testing::Combine(
+             ::testing::ValuesIn(kernel_input_shapes),
+             ::testing::ValuesIn(kernel_indices),
+             ::testing::ValuesIn(kernel_segment_ids),
+             ::testing::ValuesIn(kernel_num_segments),
+             ::testing::ValuesIn(kernel_default_index),
+             ::testing::ValuesIn(with_weights),
+             ::testing::ValuesIn(with_default_index)),
+         ::testing::Values(ElementType::f32, ElementType::bf16),
+         ::testing::Values(ElementType::i32),
+         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+#include <numeric>
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   parameter [1, 4096]    const [1, 4096]
+ *              \              /
+ *                    Add
+ *                     |
+ *                   Result
+ *
+ * The model compiled the second time is imported from the cache, its weights are mapped from the cache file.
+ * The path of the cache file is internal, so it isn't reported among the supported properties.
+ */
+
+class CacheMappedWeightsTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        cacheDir = CommonTestUtils::generateTestFilePrefix() + "_cache_mapped_weights";
+        CommonTestUtils::createDirectory(cacheDir);
+    }
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    std::string cacheDir;
+};
+
+TEST_F(CacheMappedWeightsTest, smoke_CacheMappedWeights_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t size = 4096;
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, size});
+    std::vector<float> values(size);
+    std::iota(values.begin(), values.end(), 0.f);
+    auto add = std::make_shared<ov::opset8::Add>(param, ov::opset8::Constant::create(ov::element::f32, {1, size}, values));
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{param}, "CacheMappedWeights");
+
+    ov::Core core;
+    const auto properties = core.get_property(CommonTestUtils::DEVICE_CPU, ov::supported_properties);
+    ASSERT_EQ(std::find(properties.begin(), properties.end(), CONFIG_KEY_INTERNAL(CACHED_BLOB_PATH)), properties.end());
+
+    core.set_property(ov::cache_dir(cacheDir));
+    for (int compilation = 0; compilation < 2; compilation++) {
+        auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+        auto inferRequest = compiledModel.create_infer_request();
+        ov::Tensor input(ov::element::f32, {1, size});
+        std::fill_n(input.data<float>(), size, 1.f);
+        inferRequest.set_input_tensor(input);
+        inferRequest.infer();
+        const auto output = inferRequest.get_output_tensor();
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(output.data<float>()[i], values[i] + 1.f) << "compilation " << compilation << ", element " << i;
+    }
+}
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+#include <random>
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *  table const [rows, depth]   parameter indices [?]   offsets const   weights const
+ *                 \                    |                    |              /
+ *                               EmbeddingBagOffsetsSum
+ *                                        |
+ *                                      Result
+ *
+ * The constant table is quantized row-wise with CPU_EMBEDDING_TABLE_QUANTIZATION, so the result differs from the exact
+ * one by at most half of the quantization step of the row for every gathered row, and it does differ, as the table
+ * is quantized on the graph construction instead of being gathered in FP32.
+ */
+
+using EmbeddingBagQuantizedTableParams = std::string;  // quantization mode
+
+class EmbeddingBagQuantizedTableTest : public ::testing::TestWithParam<EmbeddingBagQuantizedTableParams>,
+                                       public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagQuantizedTableParams>& obj) {
+        return "quantization=" + obj.param;
+    }
+};
+
+TEST_P(EmbeddingBagQuantizedTableTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto& quantization = GetParam();
+    // the odd depth covers the tails of the vectors and the half filled byte of INT4
+    const size_t rows = 50, depth = 37;
+    const std::vector<int32_t> indices = {3, 7, 7, 49, 0, 12, 25, 25, 25, 1};
+    const std::vector<int32_t> offsets = {0, 2, 2, 6};
+    const std::vector<float> weights = {0.5f, 1.f, -1.f, 0.25f, 2.f, 1.f, 0.5f, 0.5f, -0.5f, 1.f};
+
+    std::vector<float> table(rows * depth);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    for (auto& value : table)
+        value = dist(gen);
+
+    auto tableNode = ov::opset8::Constant::create(ov::element::f32, {rows, depth}, table);
+    auto indicesNode = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    auto offsetsNode = ov::opset8::Constant::create(ov::element::i32, {offsets.size()}, offsets);
+    auto defaultIndex = ov::opset8::Constant::create(ov::element::i32, {}, {0});
+    auto weightsNode = ov::opset8::Constant::create(ov::element::f32, {weights.size()}, weights);
+    auto embBag = std::make_shared<ov::opset8::EmbeddingBagOffsetsSum>(tableNode, indicesNode, offsetsNode,
+                                                                        defaultIndex, weightsNode);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{embBag}, ov::ParameterVector{indicesNode},
+                                             "EmbeddingBagQuantizedTable");
+
+    ov::Core core;
+    const ov::AnyMap config = {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_EMBEDDING_TABLE_QUANTIZATION,
+                                quantization}};
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+    auto inferRequest = compiledModel.create_infer_request();
+
+    ov::Tensor input(ov::element::i32, {indices.size()});
+    std::copy(indices.begin(), indices.end(), input.data<int32_t>());
+    inferRequest.set_input_tensor(input);
+    inferRequest.infer();
+
+    const auto output = inferRequest.get_output_tensor();
+    ASSERT_EQ(output.get_shape(), (ov::Shape{offsets.size(), depth}));
+    const auto* data = output.data<float>();
+
+    // the values are in [-1, 1], so the step is at most 2 / levels
+    const float levels = quantization == InferenceEngine::PluginConfigInternalParams::INT8 ? 255.f : 15.f;
+    float maxError = 0.f;
+    for (size_t bag = 0; bag < offsets.size(); bag++) {
+        const size_t begin = offsets[bag];
+        const size_t end = bag + 1 < offsets.size() ? offsets[bag + 1] : indices.size();
+        for (size_t i = 0; i < depth; i++) {
+            float expected = 0.f, threshold = 1e-5f;
+            for (size_t j = begin; j < end; j++) {
+                expected += table[indices[j] * depth + i] * weights[j];
+                threshold += std::abs(weights[j]) / levels;
+            }
+            // the empty bag takes the row of the default index without the weight
+            if (begin == end) {
+                expected = table[i];
+                threshold += 1.f / levels;
+            }
+            ASSERT_NEAR(data[bag * depth + i], expected, threshold) << "bag " << bag << ", element " << i;
+            maxError = std::max(maxError, std::abs(data[bag * depth + i] - expected));
+        }
+    }
+    // the table is quantized only if the kernel is supported (avx2), otherwise it stays FP32;
+    // the exact FP32 table would give the error of the rounding of the sums only
+    if (InferenceEngine::with_cpu_x86_avx2())
+        ASSERT_GT(maxError, 0.1f / levels);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagQuantizedTable_CPU, EmbeddingBagQuantizedTableTest,
+                         ::testing::Values(InferenceEngine::PluginConfigInternalParams::INT8,
+                                           InferenceEngine::PluginConfigInternalParams::INT4),
+                         EmbeddingBagQuantizedTableTest::getTestCaseName);
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/constant_folding.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <sstream>
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                     const [1, 8, 4, 4]   const [1, 8, 4, 4]
+ *                               \              /
+ *   parameter [1, 8, 4, 4]       Multiply (constant folding is disabled)
+ *              \                /
+ *                     Add
+ *                      |
+ *                    Result
+ *
+ * The output of the constant Multiply is exported with the network as a compiled constant.
+ * The imported network restores it instead of executing the Multiply: the import of the blob whose constants
+ * are overwritten produces the overwritten values.
+ */
+
+class ExportImportConstantsTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        std::vector<float> values(ov::shape_size(shape));
+        std::iota(values.begin(), values.end(), 0.f);
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto multiply = std::make_shared<ov::opset8::Multiply>(ov::opset8::Constant::create(ov::element::f32, shape, values),
+                                                               ov::opset8::Constant::create(ov::element::f32, shape, {2.f}));
+        ov::pass::disable_constant_folding(multiply);
+        auto add = std::make_shared<ov::opset8::Add>(param, multiply);
+        model = std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{param}, "ExportImportConstants");
+
+        reference.resize(values.size());
+        std::transform(values.begin(), values.end(), reference.begin(), [](float value) {
+            return 1.f + 2.f * value;
+        });
+    }
+
+    std::vector<float> infer(ov::CompiledModel& compiledModel) const {
+        auto inferRequest = compiledModel.create_infer_request();
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), 1.f);
+        inferRequest.set_input_tensor(input);
+        inferRequest.infer();
+        const auto output = inferRequest.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+
+    // overwrites the data of the compiled constants exported with the network, returns the number of the constants
+    static size_t fillCompiledConstants(std::string& blob, float value) {
+        const char magic[] = "OV_CPU_CONSTS_1";
+        auto pos = blob.rfind(magic, std::string::npos, sizeof magic);
+        if (pos == std::string::npos)
+            return 0;
+        pos += sizeof magic;
+        auto readSize = [&]() {
+            uint64_t size = 0;
+            std::memcpy(&size, &blob[pos], sizeof size);
+            pos += sizeof size;
+            return size;
+        };
+        const auto isaSize = readSize();
+        pos += isaSize;
+        const auto count = readSize();
+        for (uint64_t i = 0; i < count; i++) {
+            const auto nameSize = readSize();
+            pos += nameSize;
+            const auto descSize = readSize();
+            pos += descSize;
+            const auto dataSize = readSize();
+            for (size_t offset = 0; offset + sizeof value <= dataSize; offset += sizeof value)
+                std::memcpy(&blob[pos + offset], &value, sizeof value);
+            pos += dataSize;
+        }
+        return count;
+    }
+
+    const ov::Shape shape{1, 8, 4, 4};
+    // the Multiply isn't a part of a snippet
+    const ov::AnyMap config{{CONFIG_KEY_INTERNAL(SNIPPETS_MODE), CONFIG_VALUE_INTERNAL(DISABLE)}};
+    std::shared_ptr<ov::Model> model;
+    std::vector<float> reference;
+};
+
+TEST_F(ExportImportConstantsTest, smoke_ExportImportConstants_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+    ASSERT_EQ(infer(compiledModel), reference);
+
+    std::stringstream exported;
+    compiledModel.export_model(exported);
+    auto blob = exported.str();
+
+    std::stringstream stream(blob);
+    auto importedModel = core.import_model(stream, CommonTestUtils::DEVICE_CPU, config);
+    ASSERT_EQ(infer(importedModel), reference);
+
+    // the Multiply isn't executed on import, its output is read from the blob
+    ASSERT_GT(fillCompiledConstants(blob, 100.f), 0u);
+    std::stringstream overwrittenStream(blob);
+    auto overwrittenModel = core.import_model(overwrittenStream, CommonTestUtils::DEVICE_CPU, config);
+    ASSERT_EQ(infer(overwrittenModel), std::vector<float>(reference.size(), 101.f));
+}
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,188 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "ie_parallel.hpp"
+
+#include <cstring>
+#include <string>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                      parameter
+ *                    /     |     \
+ *                   /      |      \
+ *            Conv 1x1  Conv 3x3  MaxPool
+ *                 |        |        |
+ *                 |        |     Conv 1x1
+ *                 |        |        |
+ *                 |       Sum (inPlace with Conv 1x1 output)
+ *                  \       |
+ *                    Concat
+ *                      |
+ *                    Result
+ */
+
+class ParallelBranchesTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void SetUp() override {
+        const std::vector<size_t> inputShape = {1, 32, 16, 16};
+        const std::vector<ptrdiff_t> padBegin = {0, 0};
+        const std::vector<ptrdiff_t> padEnd = {0, 0};
+        const size_t convOutChannels = 32;
+
+        auto inputParams = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+
+        auto conv1x1 = ngraph::builder::makeConvolution(inputParams[0], ngraph::element::f32, {1, 1}, {1, 1}, padBegin,
+                                                        padEnd, {1, 1}, ngraph::op::PadType::AUTO, convOutChannels);
+        auto conv3x3 = ngraph::builder::makeConvolution(inputParams[0], ngraph::element::f32, {3, 3}, {1, 1}, padBegin,
+                                                        padEnd, {1, 1}, ngraph::op::PadType::SAME_UPPER, convOutChannels);
+        auto pool = ngraph::builder::makePooling(inputParams[0], {1, 1}, {0, 0}, {0, 0}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::SAME_UPPER, false, ngraph::helpers::PoolingTypes::MAX);
+        auto poolConv = ngraph::builder::makeConvolution(pool, ngraph::element::f32, {1, 1}, {1, 1}, padBegin,
+                                                         padEnd, {1, 1}, ngraph::op::PadType::AUTO, convOutChannels);
+        auto sum = std::make_shared<ngraph::opset3::Add>(conv3x3, poolConv);
+
+        auto concat = ngraph::builder::makeConcat(ngraph::OutputVector{conv1x1, sum}, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ParallelBranches");
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES});
+        configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+    }
+};
+
+// Subgraph:
+/*
+ *   parameter offsets 0      parameter data      parameter offsets 1
+ *                \           /           \           /
+ *          DeformableConvolution        DeformableConvolution
+ *                          \                 /
+ *                                Concat
+ *                                  |
+ *                                Result
+ *
+ * Both DeformableConvolution nodes have the same runtime cache key, while their executor keeps the buffers of
+ * the execution, so the nodes executed concurrently must not share it.
+ */
+
+class ParallelBranchesStatefulExecutorsTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void SetUp() override {
+        const std::vector<size_t> dataShape = {1, 4, 16, 16};
+        const std::vector<size_t> offsetsShape = {1, 18, 16, 16};
+        auto inputParams = ngraph::builder::makeParams(ngraph::element::f32, {offsetsShape, dataShape, offsetsShape});
+        auto filters = ngraph::builder::makeConstant<float>(ngraph::element::f32, {8, 4, 3, 3}, {}, true);
+
+        auto makeDefConv = [&](const std::shared_ptr<ngraph::Node>& offsets) {
+            return std::make_shared<ngraph::op::v8::DeformableConvolution>(inputParams[1], offsets, filters,
+                                                                           ngraph::Strides{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                                           ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+        };
+        auto concat = ngraph::builder::makeConcat(ngraph::OutputVector{makeDefConv(inputParams[0]), makeDefConv(inputParams[2])}, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ParallelBranchesStatefulExecutors");
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES});
+    }
+};
+
+// Subgraph:
+/*
+ *                  parameter
+ *                 /         \
+ *   ReadValue   Relu       Sigmoid
+ *         \     /            |
+ *           Add              |
+ *          /    \           /
+ *    Assign       Concat
+ *                   |
+ *                 Result
+ *
+ * Relu and Sigmoid are independent, but the MemoryInput/MemoryOutput nodes communicate through the state storage,
+ * which isn't represented by the edges, so the graph is executed serially.
+ */
+
+class ParallelBranchesStatefulModelTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel() {
+        const ov::Shape shape{1, 16};
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "state"});
+        auto readValue = std::make_shared<ov::opset8::ReadValue>(
+            ov::opset8::Constant::create(ov::element::f32, shape, {0.f}), variable);
+        auto add = std::make_shared<ov::opset8::Add>(readValue, std::make_shared<ov::opset8::Relu>(param));
+        auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+        auto concat = std::make_shared<ov::opset8::Concat>(
+            ov::OutputVector{add, std::make_shared<ov::opset8::Sigmoid>(param)}, 1);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(concat)},
+                                           ov::SinkVector{assign}, ov::ParameterVector{param},
+                                           "ParallelBranchesStatefulModel");
+    }
+};
+
+namespace {
+    TEST_F(ParallelBranchesTest, smoke_ParallelBranches_CPU) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        Run();
+
+        // the summary is reported only by the graph executed in the parallel branches mode,
+        // its exec type is "width_<widest level>_peak_<peak concurrency>"
+        const auto perfCounts = inferRequest.GetPerformanceCounts();
+        const auto summary = perfCounts.find("ParallelBranches");
+        ASSERT_NE(summary, perfCounts.end());
+        ASSERT_EQ(summary->second.status, InferenceEngineProfileInfo::EXECUTED);
+        ASSERT_STREQ(summary->second.layer_type, "ParallelBranches");
+        const std::string execType = summary->second.exec_type;
+        ASSERT_EQ(execType.find("width_"), 0u) << execType;
+        // Conv 1x1, Conv 3x3 and MaxPool are on the same level
+        ASSERT_GE(std::stoul(execType.substr(std::strlen("width_"))), 3u) << execType;
+#else
+        GTEST_SKIP() << "The parallel branches are executed with TBB only";
+#endif
+    }
+
+    TEST_F(ParallelBranchesStatefulModelTest, smoke_ParallelBranches_StatefulModelSerial_CPU) {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        ov::Core core;
+        auto compiledModel = core.compile_model(makeModel(), CommonTestUtils::DEVICE_CPU,
+            {{PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES}, ov::enable_profiling(true)});
+        auto inferRequest = compiledModel.create_infer_request();
+        ov::Tensor input(ov::element::f32, {1, 16});
+        std::fill_n(input.data<float>(), input.get_size(), 1.f);
+        inferRequest.set_input_tensor(input);
+        for (int i = 1; i <= 2; i++) {
+            inferRequest.infer();
+            const auto output = inferRequest.get_output_tensor();
+            ASSERT_EQ(output.data<float>()[0], static_cast<float>(i));
+        }
+
+        const auto profilingInfo = inferRequest.get_profiling_info();
+        ASSERT_FALSE(profilingInfo.empty());
+        for (const auto& info : profilingInfo)
+            ASSERT_NE(info.node_name, "ParallelBranches");
+    }
+
+    TEST_F(ParallelBranchesStatefulExecutorsTest, smoke_ParallelBranches_StatefulExecutors_CPU) {
+        // the concurrent execution is nondeterministic, so repeat it
+        for (int i = 0; i < 10; i++)
+            Run();
+    }
+} // namespace
+} // namespace SubgraphTestsDefinitions
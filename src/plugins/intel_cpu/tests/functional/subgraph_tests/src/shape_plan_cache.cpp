@@ -0,0 +1,197 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *      parameter [?, 16]
+ *          |
+ *     Add (const 1)
+ *          |
+ *        Relu
+ *          |
+ *        Result
+ *
+ * The output shapes are defined by the input shape, so the inference with the repeated input shapes
+ * uses the cached shape plans instead of the shape inference.
+ */
+
+class ShapePlanCacheTest : public ::testing::Test, public CPUTestsBase {};
+
+TEST_F(ShapePlanCacheTest, smoke_ShapePlanCache_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto constant = ov::opset8::Constant::create(ov::element::f32, {1}, {1.f});
+    auto add = std::make_shared<ov::opset8::Add>(param, constant);
+    auto relu = std::make_shared<ov::opset8::Relu>(add);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{param}, "ShapePlanCache");
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, ov::enable_profiling(true));
+    auto inferRequest = compiledModel.create_infer_request();
+
+    const std::vector<size_t> batches = {1, 3, 1, 3, 1};
+    for (auto batch : batches) {
+        ov::Tensor input(ov::element::f32, {batch, 16});
+        std::fill_n(input.data<float>(), input.get_size(), -2.f);
+        inferRequest.set_input_tensor(input);
+        inferRequest.infer();
+
+        const auto output = inferRequest.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), (ov::Shape{batch, 16}));
+        ASSERT_EQ(output.data<float>()[output.get_size() - 1], 0.f);
+    }
+
+    const auto perfCounts = inferRequest.get_profiling_info();
+    const auto summary = std::find_if(perfCounts.begin(), perfCounts.end(), [](const ov::ProfilingInfo& info) {
+        return info.node_type == "ShapePlanCache";
+    });
+    ASSERT_NE(summary, perfCounts.end());
+    ASSERT_EQ(summary->exec_type, "hits_3_misses_2");
+}
+
+// Subgraph:
+/*
+ *   parameter data [?, 12]   parameter target [2]      parameter stop []
+ *                 \             /                           |
+ *                    Reshape                  Range (const 0, stop, const 1)
+ *                       |                                   |
+ *                     Relu                                Result
+ *                       |
+ *                     Result
+ *
+ * The output shapes depend on the values of the inputs with the same shapes, so the shape plans must not be cached.
+ */
+std::shared_ptr<ov::Model> makeValueDependentModel() {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 12});
+    auto target = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::PartialShape{2});
+    auto stop = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::PartialShape{});
+    auto reshape = std::make_shared<ov::opset8::Reshape>(data, target, false);
+    auto relu = std::make_shared<ov::opset8::Relu>(reshape);
+    auto range = std::make_shared<ov::opset8::Range>(ov::opset8::Constant::create(ov::element::i32, {}, {0}), stop,
+                                                     ov::opset8::Constant::create(ov::element::i32, {}, {1}),
+                                                     ov::element::i32);
+    return std::make_shared<ov::Model>(ov::NodeVector{relu, range}, ov::ParameterVector{data, target, stop},
+                                       "ValueDependentShapes");
+}
+
+void inferValueDependentModel(ov::InferRequest& inferRequest) {
+    const std::vector<std::vector<int32_t>> targets = {{4, 6}, {3, 8}, {4, 6}, {6, 4}, {3, 8}};
+    const std::vector<int32_t> stops = {5, 7, 5, 2, 7};
+    for (size_t i = 0; i < targets.size(); i++) {
+        ov::Tensor data(ov::element::f32, {2, 12});
+        for (size_t j = 0; j < data.get_size(); j++)
+            data.data<float>()[j] = static_cast<float>(j) - 4.f;
+        ov::Tensor target(ov::element::i32, {2});
+        std::copy(targets[i].begin(), targets[i].end(), target.data<int32_t>());
+        ov::Tensor stop(ov::element::i32, {});
+        stop.data<int32_t>()[0] = stops[i];
+        inferRequest.set_input_tensor(0, data);
+        inferRequest.set_input_tensor(1, target);
+        inferRequest.set_input_tensor(2, stop);
+        inferRequest.infer();
+
+        const auto reshaped = inferRequest.get_output_tensor(0);
+        ASSERT_EQ(reshaped.get_shape(), (ov::Shape{static_cast<size_t>(targets[i][0]), static_cast<size_t>(targets[i][1])}));
+        for (size_t j = 0; j < reshaped.get_size(); j++)
+            ASSERT_EQ(reshaped.data<float>()[j], std::max(static_cast<float>(j) - 4.f, 0.f)) << "inference " << i;
+        const auto range = inferRequest.get_output_tensor(1);
+        ASSERT_EQ(range.get_shape(), (ov::Shape{static_cast<size_t>(stops[i])}));
+        for (size_t j = 0; j < range.get_size(); j++)
+            ASSERT_EQ(range.data<int32_t>()[j], static_cast<int32_t>(j)) << "inference " << i;
+    }
+}
+
+TEST_F(ShapePlanCacheTest, smoke_ShapePlanCache_ValueDependentShapes_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeValueDependentModel(), CommonTestUtils::DEVICE_CPU, ov::enable_profiling(true));
+    auto inferRequest = compiledModel.create_infer_request();
+    inferValueDependentModel(inferRequest);
+
+    const auto perfCounts = inferRequest.get_profiling_info();
+    const auto summary = std::find_if(perfCounts.begin(), perfCounts.end(), [](const ov::ProfilingInfo& info) {
+        return info.node_type == "ShapePlanCache";
+    });
+    ASSERT_EQ(summary, perfCounts.end());
+}
+
+// Subgraph:
+/*
+ *      parameter [?, 16]
+ *          |       |
+ *     Add (const 1)|
+ *          |       |
+ *        Relu      |
+ *            \     /
+ *            Concat
+ *              |
+ *      Multiply (const 2)
+ *              |
+ *           Result
+ *
+ * The intermediate tensors are placed in the memory arena, the shrink policy reallocates it for the smaller shapes.
+ */
+TEST_F(ShapePlanCacheTest, smoke_ShapePlanCache_MemoryArena_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto add = std::make_shared<ov::opset8::Add>(param, ov::opset8::Constant::create(ov::element::f32, {1}, {1.f}));
+    auto relu = std::make_shared<ov::opset8::Relu>(add);
+    auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{relu, param}, 1);
+    auto mul = std::make_shared<ov::opset8::Multiply>(concat, ov::opset8::Constant::create(ov::element::f32, {1}, {2.f}));
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{mul}, ov::ParameterVector{param}, "MemoryArena");
+
+    ov::Core core;
+    const ov::AnyMap config = {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA, "YES"},
+                               {InferenceEngine::PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA_SHRINK, "YES"}};
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+    auto inferRequest = compiledModel.create_infer_request();
+
+    const std::vector<size_t> batches = {1, 64, 2, 64, 1, 2};
+    for (auto batch : batches) {
+        const auto value = static_cast<float>(batch);
+        ov::Tensor input(ov::element::f32, {batch, 16});
+        std::fill_n(input.data<float>(), input.get_size(), value);
+        inferRequest.set_input_tensor(input);
+        inferRequest.infer();
+
+        const auto output = inferRequest.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), (ov::Shape{batch, 32}));
+        const auto* data = output.data<float>();
+        for (size_t i = 0; i < output.get_size(); i++) {
+            const auto expected = (i % 32 < 16 ? value + 1.f : value) * 2.f;
+            ASSERT_EQ(data[i], expected) << "batch " << batch << ", element " << i;
+        }
+    }
+}
+
+// the memory arena is placed according to the shape plans, so it must not be used for the value dependent shapes
+TEST_F(ShapePlanCacheTest, smoke_ShapePlanCache_MemoryArena_ValueDependentShapes_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    const ov::AnyMap config = {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA, "YES"},
+                               {InferenceEngine::PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA_SHRINK, "YES"},
+                               ov::enable_profiling(true)};
+    auto compiledModel = core.compile_model(makeValueDependentModel(), CommonTestUtils::DEVICE_CPU, config);
+    auto inferRequest = compiledModel.create_infer_request();
+    inferValueDependentModel(inferRequest);
+
+    const auto perfCounts = inferRequest.get_profiling_info();
+    const auto summary = std::find_if(perfCounts.begin(), perfCounts.end(), [](const ov::ProfilingInfo& info) {
+        return info.node_type == "ShapePlanCache";
+    });
+    ASSERT_EQ(summary, perfCounts.end());
+}
+} // namespace SubgraphTestsDefinitions
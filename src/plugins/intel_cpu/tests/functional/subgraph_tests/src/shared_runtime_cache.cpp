@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+#include <random>
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *  parameter data [?, 4, ?, ?]   parameter offsets [?, 18, ?, ?]   filters const
+ *                      \                   |                      /
+ *                               DeformableConvolution
+ *                                        |
+ *                                      Result
+ *
+ * The DeformableConvolution executor keeps the sampling buffers of the execution, so the streams sharing the runtime
+ * cache (CPU_SHARED_RUNTIME_CACHE) must not share it. The streams infer the same shapes with the different data
+ * concurrently and every result must match the one of the sequential inference.
+ */
+
+TEST(SharedRuntimeCacheTest, smoke_SharedRuntimeCache_ConcurrentStreams_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t channels = 4, outChannels = 8, height = 16, width = 16;
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, channels, -1, -1});
+    auto offsets = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 18, -1, -1});
+    std::vector<float> filtersData(outChannels * channels * 9);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    for (auto& value : filtersData)
+        value = dist(gen);
+    auto filters = ov::opset8::Constant::create(ov::element::f32, {outChannels, channels, 3, 3}, filtersData);
+    auto defConv = std::make_shared<ov::opset8::DeformableConvolution>(data, offsets, filters, ov::Strides{1, 1},
+                                                                       ov::CoordinateDiff{1, 1}, ov::CoordinateDiff{1, 1},
+                                                                       ov::Strides{1, 1});
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{defConv}, ov::ParameterVector{data, offsets},
+                                             "SharedRuntimeCache");
+
+    constexpr size_t numRequests = 4;
+    std::vector<ov::Tensor> dataTensors, offsetsTensors;
+    std::uniform_real_distribution<float> offsetsDist(-2.f, 2.f);
+    for (size_t i = 0; i < numRequests; i++) {
+        dataTensors.emplace_back(ov::element::f32, ov::Shape{1, channels, height, width});
+        offsetsTensors.emplace_back(ov::element::f32, ov::Shape{1, 18, height, width});
+        auto* dataPtr = dataTensors.back().data<float>();
+        for (size_t j = 0; j < dataTensors.back().get_size(); j++)
+            dataPtr[j] = dist(gen);
+        auto* offsetsPtr = offsetsTensors.back().data<float>();
+        for (size_t j = 0; j < offsetsTensors.back().get_size(); j++)
+            offsetsPtr[j] = offsetsDist(gen);
+    }
+
+    ov::Core core;
+    auto referenceModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    auto referenceRequest = referenceModel.create_infer_request();
+    std::vector<std::vector<float>> references;
+    for (size_t i = 0; i < numRequests; i++) {
+        referenceRequest.set_input_tensor(0, dataTensors[i]);
+        referenceRequest.set_input_tensor(1, offsetsTensors[i]);
+        referenceRequest.infer();
+        const auto output = referenceRequest.get_output_tensor();
+        references.emplace_back(output.data<float>(), output.data<float>() + output.get_size());
+    }
+
+    const ov::AnyMap config = {{InferenceEngine::PluginConfigInternalParams::KEY_CPU_SHARED_RUNTIME_CACHE,
+                                InferenceEngine::PluginConfigParams::YES},
+                               ov::num_streams(static_cast<int>(numRequests))};
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++) {
+        requests.push_back(compiledModel.create_infer_request());
+        requests.back().set_input_tensor(0, dataTensors[i]);
+        requests.back().set_input_tensor(1, offsetsTensors[i]);
+    }
+
+    for (int iteration = 0; iteration < 20; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (auto& request : requests)
+            request.wait();
+        for (size_t i = 0; i < numRequests; i++) {
+            const auto output = requests[i].get_output_tensor();
+            ASSERT_EQ(references[i].size(), output.get_size());
+            const auto* outputPtr = output.data<float>();
+            for (size_t j = 0; j < output.get_size(); j++)
+                ASSERT_NEAR(references[i][j], outputPtr[j], 1e-4f) << "iteration " << iteration << ", request " << i << ", element " << j;
+        }
+    }
+}
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *        parameter_0            parameter_1            parameter_2
+ *             |                      |                      |
+ *       Add (scalar 1)         Add (scalar 1)         Add (scalar 2)
+ *             |                      |                      |
+ *        Multiply(p0)           Multiply(p1)           Multiply(p2)
+ *             |                      |                      |
+ *           Relu                   Relu                   Relu
+ *             |                      |                      |
+ *          Result                 Result                 Result
+ *
+ * All three chains are tokenized into structurally identical snippets. The first two must share
+ * the generated kernel, while the third one differs only in the scalar value and must not
+ * (see SnippetsKernelSharingTest of the unit tests).
+ */
+
+class SnippetsKernelSharingTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void SetUp() override {
+        const std::vector<size_t> inputShape = {1, 16, 8, 8};
+        auto inputParams = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, inputShape, inputShape});
+
+        auto makeChain = [](const std::shared_ptr<ngraph::Node>& param, float scalar) {
+            auto constant = ngraph::builder::makeConstant(ngraph::element::f32, {1}, std::vector<float>{scalar});
+            auto add = std::make_shared<ngraph::opset3::Add>(param, constant);
+            auto mul = std::make_shared<ngraph::opset3::Multiply>(add, param);
+            auto relu = std::make_shared<ngraph::opset3::Relu>(mul);
+            return std::make_shared<ngraph::opset3::Result>(relu);
+        };
+
+        ngraph::ResultVector results{makeChain(inputParams[0], 1.f),
+                                     makeChain(inputParams[1], 1.f),
+                                     makeChain(inputParams[2], 2.f)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "SnippetsKernelSharing");
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+    }
+};
+
+namespace {
+    TEST_F(SnippetsKernelSharingTest, smoke_SnippetsKernelSharing_CPU) {
+        Run();
+        // every chain is executed by a snippet
+        if (InferenceEngine::with_cpu_x86_avx2())
+            CheckNumberOfNodesWithType(executableNetwork, "Subgraph", 3);
+    }
+} // namespace
+} // namespace SubgraphTestsDefinitions
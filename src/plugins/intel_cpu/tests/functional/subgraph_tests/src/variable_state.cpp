@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   parameter [1, 8]    ReadValue (const 0)
+ *              \          /
+ *                  Add
+ *                /     \
+ *           Assign     Result
+ *
+ * The state accumulates the inputs. The variable state is kept in two buffers swapped on every inference,
+ * the states got from the request must not change with the following inferences.
+ */
+
+class VariableStateTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    std::shared_ptr<ov::Model> makeModel(const ov::PartialShape& shape) {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "accumulator"});
+        auto init = std::make_shared<ov::opset8::Broadcast>(ov::opset8::Constant::create(ov::element::f32, {}, {0.f}),
+                                                            std::make_shared<ov::opset8::ShapeOf>(param));
+        auto readValue = std::make_shared<ov::opset8::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::opset8::Add>(readValue, param);
+        auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+        auto result = std::make_shared<ov::opset8::Result>(add);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{param},
+                                           "VariableState");
+    }
+
+    static void fill(ov::Tensor& tensor, float value) {
+        std::fill_n(tensor.data<float>(), tensor.get_size(), value);
+    }
+
+    static void check(const ov::Tensor& tensor, const ov::Shape& shape, float expected, const std::string& what) {
+        ASSERT_EQ(tensor.get_shape(), shape) << what;
+        const auto* data = tensor.data<const float>();
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            ASSERT_EQ(data[i], expected) << what << ", element " << i;
+    }
+};
+
+TEST_F(VariableStateTest, smoke_VariableState_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const ov::Shape shape{1, 8};
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(shape), CommonTestUtils::DEVICE_CPU);
+    auto inferRequest = compiledModel.create_infer_request();
+    auto states = inferRequest.query_state();
+    ASSERT_EQ(states.size(), 1);
+    ASSERT_EQ(states[0].get_name(), "accumulator");
+
+    ov::Tensor input(ov::element::f32, shape);
+    fill(input, 1.f);
+    inferRequest.set_input_tensor(input);
+
+    std::vector<ov::Tensor> stateHistory;
+    for (int i = 1; i <= 5; i++) {
+        inferRequest.infer();
+        check(inferRequest.get_output_tensor(), shape, static_cast<float>(i), "output of inference " + std::to_string(i));
+        stateHistory.push_back(inferRequest.query_state()[0].get_state());
+    }
+    // the states are the snapshots, they aren't affected by the buffers swapped by the following inferences
+    for (size_t i = 0; i < stateHistory.size(); i++)
+        check(stateHistory[i], shape, static_cast<float>(i + 1), "state after inference " + std::to_string(i + 1));
+
+    ov::Tensor newState(ov::element::f32, shape);
+    fill(newState, 10.f);
+    inferRequest.query_state()[0].set_state(newState);
+    check(inferRequest.query_state()[0].get_state(), shape, 10.f, "set state");
+    inferRequest.infer();
+    check(inferRequest.get_output_tensor(), shape, 11.f, "output after set state");
+    inferRequest.infer();
+    check(inferRequest.get_output_tensor(), shape, 12.f, "second output after set state");
+
+    inferRequest.query_state()[0].reset();
+    check(inferRequest.query_state()[0].get_state(), shape, 0.f, "reset state");
+    inferRequest.infer();
+    check(inferRequest.get_output_tensor(), shape, 1.f, "output after reset");
+    check(inferRequest.query_state()[0].get_state(), shape, 1.f, "state after reset");
+}
+
+// Subgraph:
+/*
+ *   parameter [1, 1]    ReadValue [1, ?]
+ *              \          /
+ *                 Concat
+ *                /     \
+ *           Assign     Result
+ *
+ * The state grows by one element per inference, like the KV cache of a sequence model. The initial and the reset
+ * states are empty, the producer writes the new state to the buffer of the request in place.
+ */
+TEST_F(VariableStateTest, smoke_VariableState_Dynamic_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 1});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{1, -1}, ov::element::f32, "sequence"});
+    auto init = std::make_shared<ov::opset8::Broadcast>(ov::opset8::Constant::create(ov::element::f32, {}, {0.f}),
+                                                        std::make_shared<ov::opset8::ShapeOf>(param));
+    auto readValue = std::make_shared<ov::opset8::ReadValue>(init, variable);
+    auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{readValue, param}, 1);
+    auto assign = std::make_shared<ov::opset8::Assign>(concat, variable);
+    auto result = std::make_shared<ov::opset8::Result>(concat);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                             ov::ParameterVector{param}, "VariableStateDynamic");
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    auto inferRequest = compiledModel.create_infer_request();
+
+    // the element j of the sequence is the value of the input of the inference j + 1
+    auto checkSequence = [](const ov::Tensor& tensor, size_t length, float first, const std::string& what) {
+        ASSERT_EQ(tensor.get_shape(), (ov::Shape{1, length})) << what;
+        const auto* data = tensor.data<const float>();
+        for (size_t j = 0; j < length; j++)
+            ASSERT_EQ(data[j], first + static_cast<float>(j)) << what << ", element " << j;
+    };
+    auto inferSequence = [&](size_t begin, size_t end, float first, const std::string& what) {
+        ov::Tensor input(ov::element::f32, {1, 1});
+        for (size_t i = begin; i < end; i++) {
+            fill(input, first + static_cast<float>(i));
+            inferRequest.set_input_tensor(input);
+            inferRequest.infer();
+            const auto name = what + ", inference " + std::to_string(i + 1);
+            checkSequence(inferRequest.get_output_tensor(), i + 1, first, "output of " + name);
+            checkSequence(inferRequest.query_state()[0].get_state(), i + 1, first, "state after " + name);
+        }
+    };
+
+    ASSERT_EQ(inferRequest.query_state()[0].get_state().get_shape(), (ov::Shape{1, 0}));
+    inferSequence(0, 40, 1.f, "initial state");
+
+    inferRequest.query_state()[0].reset();
+    ASSERT_EQ(inferRequest.query_state()[0].get_state().get_shape(), (ov::Shape{1, 0}));
+    inferSequence(0, 10, 1.f, "reset state");
+
+    ov::Tensor newState(ov::element::f32, {1, 3});
+    for (size_t j = 0; j < newState.get_size(); j++)
+        newState.data<float>()[j] = 5.f + static_cast<float>(j);
+    inferRequest.query_state()[0].set_state(newState);
+    inferSequence(3, 20, 5.f, "set state");
+}
+} // namespace SubgraphTestsDefinitions
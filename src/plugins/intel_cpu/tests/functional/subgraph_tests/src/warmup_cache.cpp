@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   parameter data [?, 12]   parameter target [2]
+ *             |                     |
+ *      Add (const 1)         Add (const 0)
+ *              \                   /
+ *                    Reshape
+ *                       |
+ *                     Result
+ *
+ * The shapes recorded by the first compiled model are prepared by the warm up of the second one. The warm up
+ * stops before the Reshape, as its output shape depends on the target values, which are known on the inference only.
+ */
+
+class WarmupCacheTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        cacheDir = CommonTestUtils::generateTestFilePrefix() + "_warmup_cache";
+        CommonTestUtils::createDirectory(cacheDir);
+    }
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "txt");
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    std::string cacheDir;
+};
+
+TEST_F(WarmupCacheTest, smoke_WarmupCache_ValueDependentShapes_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 12});
+    auto target = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::PartialShape{2});
+    auto add = std::make_shared<ov::opset8::Add>(data, ov::opset8::Constant::create(ov::element::f32, {1}, {1.f}));
+    auto targetAdd = std::make_shared<ov::opset8::Add>(target, ov::opset8::Constant::create(ov::element::i32, {1}, {0}));
+    auto reshape = std::make_shared<ov::opset8::Reshape>(add, targetAdd, false);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{reshape}, ov::ParameterVector{data, target}, "WarmupCache");
+
+    const std::vector<std::vector<int32_t>> targets = {{4, 6}, {2, 12}, {3, 8}, {6, 4}};
+    auto infer = [&](ov::CompiledModel& compiledModel) {
+        auto inferRequest = compiledModel.create_infer_request();
+        for (size_t i = 0; i < targets.size(); i++) {
+            ov::Tensor dataTensor(ov::element::f32, {2, 12});
+            for (size_t j = 0; j < dataTensor.get_size(); j++)
+                dataTensor.data<float>()[j] = static_cast<float>(j);
+            ov::Tensor targetTensor(ov::element::i32, {2});
+            std::copy(targets[i].begin(), targets[i].end(), targetTensor.data<int32_t>());
+            inferRequest.set_input_tensor(0, dataTensor);
+            inferRequest.set_input_tensor(1, targetTensor);
+            inferRequest.infer();
+
+            const auto output = inferRequest.get_output_tensor();
+            ASSERT_EQ(output.get_shape(), (ov::Shape{static_cast<size_t>(targets[i][0]), static_cast<size_t>(targets[i][1])}));
+            for (size_t j = 0; j < output.get_size(); j++)
+                ASSERT_EQ(output.data<float>()[j], static_cast<float>(j) + 1.f) << "inference " << i;
+        }
+    };
+
+    ov::Core core;
+    core.set_property(CommonTestUtils::DEVICE_CPU, ov::cache_dir(cacheDir));
+    {
+        auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+        infer(compiledModel);
+    }
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    infer(compiledModel);
+}
+} // namespace SubgraphTestsDefinitions
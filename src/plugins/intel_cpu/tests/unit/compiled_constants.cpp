@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include "compiled_constants.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+MemoryPtr makeMemory(const MemoryDesc& desc) {
+    auto memory = std::make_shared<Memory>(dnnl::engine(dnnl::engine::kind::cpu, 0));
+    memory->Create(desc);
+    auto data = static_cast<float*>(memory->GetData());
+    std::iota(data, data + memory->GetSize() / sizeof(float), 1.f);
+    return memory;
+}
+}   // namespace
+
+TEST(CompiledConstantsTest, WriteAndRead) {
+    const CpuBlockedMemoryDesc plain(Precision::FP32, Shape(VectorDims{4, 8}));
+    const CpuBlockedMemoryDesc blocked(Precision::FP32, Shape(VectorDims{4, 8}), {1, 8, 4}, {0, 1, 0});
+    const auto plainMemory = makeMemory(plain);
+    const auto blockedMemory = makeMemory(blocked);
+
+    std::stringstream stream;
+    CompiledConstants::write(stream, {{"plain", plainMemory}, {"blocked", blockedMemory}});
+    const auto constants = CompiledConstants::read(stream);
+    ASSERT_NE(constants, nullptr);
+    ASSERT_EQ(constants->size(), 2u);
+
+    // the data is read from the stream on demand, in any order
+    std::vector<uint8_t> data(blockedMemory->GetSize());
+    ASSERT_TRUE(constants->load("blocked", blocked, data.data(), data.size()));
+    ASSERT_EQ(std::memcmp(data.data(), blockedMemory->GetData(), data.size()), 0);
+    data.assign(plainMemory->GetSize(), 0);
+    ASSERT_TRUE(constants->load("plain", plain, data.data(), data.size()));
+    ASSERT_EQ(std::memcmp(data.data(), plainMemory->GetData(), data.size()), 0);
+
+    // the layout or the size of the edge memory differs from the exported one
+    ASSERT_FALSE(constants->load("plain", blocked, data.data(), data.size()));
+    ASSERT_FALSE(constants->load("plain", plain, data.data(), data.size() - 1));
+    ASSERT_FALSE(constants->load("unknown", plain, data.data(), data.size()));
+}
+
+TEST(CompiledConstantsTest, InvalidSection) {
+    std::stringstream noSection("<net/>");
+    ASSERT_EQ(CompiledConstants::read(noSection), nullptr);
+
+    std::stringstream stream;
+    const CpuBlockedMemoryDesc desc(Precision::FP32, Shape(VectorDims{2, 3}));
+    CompiledConstants::write(stream, {{"edge", makeMemory(desc)}});
+    auto content = stream.str();
+    content.resize(content.size() - 1);
+    std::stringstream truncated(content);
+    ASSERT_EQ(CompiledConstants::read(truncated), nullptr);
+}
@@ -17,3 +17,19 @@ TEST(MemoryTest, SedDataCheck) {
 TEST(MemoryTest, SedDataWithAutoPadCheck) {
     GTEST_SKIP();
 }
+
+TEST(MemoryTest, MemoryMngrWithGrowth) {
+    MemoryMngrWithGrowth mngr(100);
+    // the first allocation reserves the requested capacity
+    ASSERT_TRUE(mngr.resize(10));
+    const auto reserved = mngr.getRawPtr();
+    ASSERT_NE(reserved, nullptr);
+    ASSERT_FALSE(mngr.resize(100));
+    ASSERT_EQ(mngr.getRawPtr(), reserved);
+
+    // the capacity is at least doubled
+    ASSERT_TRUE(mngr.resize(101));
+    ASSERT_FALSE(mngr.resize(200));
+    ASSERT_TRUE(mngr.resize(1000));
+    ASSERT_FALSE(mngr.hasExtBuffer());
+}
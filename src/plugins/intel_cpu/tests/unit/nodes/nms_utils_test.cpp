@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "nodes/common/nms_utils.h"
+
+using namespace ov::intel_cpu;
+
+namespace NmsUtilsTest {
+// the scalar IoU of MulticlassNms: zero if any of the areas isn't positive
+float multiclassIou(const float* boxI, const float* boxJ, bool normalized) {
+    const float norm = normalized ? 0.f : 1.f;
+    const float areaI = (boxI[2] - boxI[0] + norm) * (boxI[3] - boxI[1] + norm);
+    const float areaJ = (boxJ[2] - boxJ[0] + norm) * (boxJ[3] - boxJ[1] + norm);
+    if (areaI <= 0.f || areaJ <= 0.f)
+        return 0.f;
+    const float inter = std::max(std::min(boxI[2], boxJ[2]) - std::max(boxI[0], boxJ[0]) + norm, 0.f) *
+                        std::max(std::min(boxI[3], boxJ[3]) - std::max(boxI[1], boxJ[1]) + norm, 0.f);
+    return inter / (areaI + areaJ - inter);
+}
+
+// the scalar IoU of MatrixNms: zero for the disjoint boxes, the area of an inverted box is zero
+float matrixIou(const float* box1, const float* box2, bool normalized) {
+    if (box2[0] > box1[2] || box2[2] < box1[0] || box2[1] > box1[3] || box2[3] < box1[1])
+        return 0.f;
+    const float norm = normalized ? 0.f : 1.f;
+    auto area = [&](const float* box) {
+        if (box[2] < box[0] || box[3] < box[1])
+            return 0.f;
+        return (box[2] - box[0] + norm) * (box[3] - box[1] + norm);
+    };
+    const float inter = (std::min(box1[2], box2[2]) - std::max(box1[0], box2[0]) + norm) *
+                        (std::min(box1[3], box2[3]) - std::max(box1[1], box2[1]) + norm);
+    return inter / (area(box1) + area(box2) - inter);
+}
+
+// the boxes are small relatively to the image, a few of them are degenerate or inverted
+std::vector<float> generateBoxes(size_t num, float imageSize, std::mt19937& gen) {
+    std::uniform_real_distribution<float> position(0.f, imageSize);
+    std::uniform_real_distribution<float> size(-0.02f * imageSize, 0.2f * imageSize);
+    std::vector<float> boxes(num * 4);
+    for (size_t i = 0; i < num; i++) {
+        boxes[i * 4] = position(gen);
+        boxes[i * 4 + 1] = position(gen);
+        boxes[i * 4 + 2] = boxes[i * 4] + size(gen);
+        boxes[i * 4 + 3] = boxes[i * 4 + 1] + size(gen);
+    }
+    return boxes;
+}
+
+// a quarter of the scores are equal to check the order of the ties
+std::vector<float> generateScores(size_t num, std::mt19937& gen) {
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> scores(num);
+    for (auto& score : scores)
+        score = gen() % 4 == 0 ? 0.5f : dist(gen);
+    return scores;
+}
+
+std::vector<NmsSortedCandidates::Candidate> fullySorted(const std::vector<float>& scores, float threshold,
+                                                        bool inclusive) {
+    std::vector<NmsSortedCandidates::Candidate> candidates;
+    for (int i = 0; i < static_cast<int>(scores.size()); i++) {
+        if (inclusive ? scores[i] >= threshold : scores[i] > threshold)
+            candidates.emplace_back(scores[i], i);
+    }
+    std::sort(candidates.begin(), candidates.end(), NmsSortedCandidates::greater);
+    return candidates;
+}
+
+TEST(NmsSortedCandidatesTest, OrderMatchesFullSort) {
+    std::mt19937 gen(7);
+    for (size_t num : {0, 1, 50, 1000, 5000}) {
+        const auto scores = generateScores(num, gen);
+        for (bool inclusive : {false, true}) {
+            const auto expected = fullySorted(scores, 0.5f, inclusive);
+            NmsSortedCandidates candidates;
+            candidates.reset(scores.data(), static_cast<int>(num), 0.5f, inclusive);
+            ASSERT_EQ(expected.size(), candidates.size());
+            // the lazy access sorts the chunks on demand, the explicit sort is only a hint
+            candidates.sortUpTo(10);
+            for (size_t i = 0; i < expected.size(); i++)
+                ASSERT_EQ(expected[i], candidates[i]) << "num " << num << ", candidate " << i;
+        }
+    }
+}
+
+TEST(NmsBoxesTest, IouMatchesScalar) {
+    std::mt19937 gen(13);
+    for (bool normalized : {true, false}) {
+        const float imageSize = normalized ? 1.f : 300.f;
+        const size_t num = 300;
+        const auto boxes = generateBoxes(num, imageSize, gen);
+        NmsBoxes multiclassBoxes(NmsIouType::MULTICLASS, normalized);
+        NmsBoxes matrixBoxes(NmsIouType::MATRIX, normalized);
+        for (size_t i = 0; i < num; i++) {
+            multiclassBoxes.push(&boxes[i * 4]);
+            matrixBoxes.push(&boxes[i * 4]);
+        }
+
+        std::vector<float> ious(num);
+        for (size_t i = 0; i < num; i++) {
+            const float* box = &boxes[i * 4];
+            // the odd begin covers the tails of the vectorized loop
+            multiclassBoxes.iou(box, 3, num, ious.data());
+            for (size_t j = 3; j < num; j++)
+                ASSERT_EQ(multiclassIou(box, &boxes[j * 4], normalized), ious[j - 3]) << "boxes " << i << ", " << j;
+            matrixBoxes.iou(box, 3, num, ious.data());
+            for (size_t j = 3; j < num; j++)
+                ASSERT_EQ(matrixIou(box, &boxes[j * 4], normalized), ious[j - 3]) << "boxes " << i << ", " << j;
+
+            bool expected = false;
+            for (size_t j = 5; j < num; j++)
+                expected |= multiclassIou(box, &boxes[j * 4], normalized) >= 0.3f;
+            ASSERT_EQ(expected, multiclassBoxes.anyIouAtLeast(box, 5, 0.3f)) << "box " << i;
+        }
+    }
+}
+
+// microbenchmark: the greedy NMS of a class with the candidate counts of SSD300, YOLOv5 at 640 and a large detector,
+// compares the full sort and the pairwise scalar IoU vs the sorted on demand candidates and the blocked IoU
+// (disabled by default, run with --gtest_also_run_disabled_tests)
+TEST(NmsUtilsBenchmark, DISABLED_GreedyNms) {
+    constexpr size_t maxOutput = 200;
+    constexpr float iouThreshold = 0.5f;
+    constexpr int repeats = 20;
+    std::mt19937 gen(42);
+    for (size_t num : {8732, 25200, 100000}) {
+        const auto boxes = generateBoxes(num, 1.f, gen);
+        const auto scores = generateScores(num, gen);
+
+        size_t referenceSelected = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; r++) {
+            const auto candidates = fullySorted(scores, 0.05f, true);
+            std::vector<int> selected;
+            for (size_t i = 0; i < candidates.size() && selected.size() < maxOutput; i++) {
+                const float* box = &boxes[candidates[i].second * 4];
+                bool suppressed = false;
+                for (int j = static_cast<int>(selected.size()) - 1; j >= 0 && !suppressed; j--)
+                    suppressed = multiclassIou(box, &boxes[selected[j] * 4], true) >= iouThreshold;
+                if (!suppressed)
+                    selected.push_back(candidates[i].second);
+            }
+            referenceSelected = selected.size();
+        }
+        const std::chrono::duration<double, std::milli> referenceTime = std::chrono::steady_clock::now() - start;
+
+        size_t selected = 0;
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; r++) {
+            NmsSortedCandidates candidates;
+            candidates.reset(scores.data(), static_cast<int>(num), 0.05f, true);
+            candidates.sortUpTo(maxOutput);
+            NmsBoxes selectedBoxes(NmsIouType::MULTICLASS, true);
+            selectedBoxes.reserve(maxOutput);
+            for (size_t i = 0; i < candidates.size() && selectedBoxes.size() < maxOutput; i++) {
+                const float* box = &boxes[candidates[i].second * 4];
+                if (!selectedBoxes.anyIouAtLeast(box, 0, iouThreshold))
+                    selectedBoxes.push(box);
+            }
+            selected = selectedBoxes.size();
+        }
+        const std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+
+        ASSERT_EQ(referenceSelected, selected);
+        std::cout << num << " candidates: full sort + scalar IoU " << referenceTime.count() / repeats
+                  << " ms, sorted on demand + blocked IoU " << time.count() / repeats << " ms" << std::endl;
+    }
+}
+}  // namespace NmsUtilsTest
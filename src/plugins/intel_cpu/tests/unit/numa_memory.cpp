@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "utils/numa_memory.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+uint64_t totalBytes(const std::map<int, uint64_t>& bytes) {
+    return std::accumulate(bytes.begin(), bytes.end(), uint64_t{0},
+                           [](uint64_t sum, const std::pair<const int, uint64_t>& node) {
+                               return sum + node.second;
+                           });
+}
+}   // namespace
+
+TEST(NumaMemoryTest, TouchedPagesAreCounted) {
+    std::vector<char> memory(10 * 4096 + 100);
+    std::memset(memory.data(), 1, memory.size());
+
+    std::map<int, uint64_t> bytes;
+    if (!getNumaNodesBytes(memory.data(), memory.size(), bytes))
+        GTEST_SKIP() << "The placement of the pages can't be queried";
+    ASSERT_EQ(totalBytes(bytes), memory.size());
+}
+
+TEST(NumaMemoryTest, AllocatedOnNode) {
+    std::vector<char> probe(4096, 1);
+    std::map<int, uint64_t> bytes;
+    if (!getNumaNodesBytes(probe.data(), probe.size(), bytes) || bytes.empty())
+        GTEST_SKIP() << "The placement of the pages can't be queried";
+    const int node = bytes.begin()->first;
+
+    const size_t size = 10 * 4096 + 100;
+    auto* memory = static_cast<char*>(allocateOnNumaNode(size, node));
+    ASSERT_NE(memory, nullptr);
+    // the pages aren't allocated before the first touch
+    bytes.clear();
+    ASSERT_TRUE(getNumaNodesBytes(memory, size, bytes));
+    ASSERT_EQ(totalBytes(bytes), uint64_t{0});
+
+    std::memset(memory, 1, size);
+    bytes.clear();
+    ASSERT_TRUE(getNumaNodesBytes(memory, size, bytes));
+    ASSERT_EQ(bytes[node], size);
+    freeOnNumaNode(memory, size);
+
+    ASSERT_EQ(allocateOnNumaNode(0, node), nullptr);
+    ASSERT_EQ(allocateOnNumaNode(size, -1), nullptr);
+}
+
+TEST(NumaMemoryTest, MemoryMngrOnNumaNode) {
+    MemoryMngrOnNumaNode mngr(0);
+    ASSERT_EQ(mngr.getRawPtr(), nullptr);
+    ASSERT_TRUE(mngr.resize(100000));
+    ASSERT_NE(mngr.getRawPtr(), nullptr);
+    ASSERT_FALSE(mngr.hasExtBuffer());
+    std::memset(mngr.getRawPtr(), 1, 100000);
+    // the buffer is reused for the smaller sizes
+    ASSERT_FALSE(mngr.resize(1000));
+
+    std::vector<char> external(100);
+    mngr.setExtBuff(external.data(), external.size());
+    ASSERT_TRUE(mngr.hasExtBuffer());
+    ASSERT_EQ(mngr.getRawPtr(), external.data());
+    ASSERT_TRUE(mngr.resize(1000));
+    ASSERT_FALSE(mngr.hasExtBuffer());
+    ASSERT_NE(mngr.getRawPtr(), external.data());
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+MemoryPtr makeMemory(const MemoryDesc& desc) {
+    auto memory = std::make_shared<Memory>(dnnl::engine(dnnl::engine::kind::cpu, 0));
+    memory->Create(desc);
+    return memory;
+}
+}   // namespace
+
+TEST(PackedWeightsStoreTest, KeyDependsOnContent) {
+    const CpuBlockedMemoryDesc plain(Precision::FP32, Shape(VectorDims{4, 8}));
+    const CpuBlockedMemoryDesc blocked(Precision::FP32, Shape(VectorDims{4, 8}), {1, 8, 4}, {0, 1, 0});
+    std::vector<float> weights(32, 1.f);
+    const auto sameWeights = weights;
+    const auto size = weights.size() * sizeof(float);
+
+    const auto key = PackedWeightsStore::makeKey(weights.data(), size, plain, blocked, 0);
+    // the address of the source weights doesn't matter
+    ASSERT_EQ(key, PackedWeightsStore::makeKey(sameWeights.data(), size, plain, blocked, 0));
+
+    ASSERT_NE(key, PackedWeightsStore::makeKey(weights.data(), size, plain, plain, 0));
+    ASSERT_NE(key, PackedWeightsStore::makeKey(weights.data(), size, plain, blocked, 1));
+    weights[17] = 2.f;
+    ASSERT_NE(key, PackedWeightsStore::makeKey(weights.data(), size, plain, blocked, 0));
+}
+
+TEST(PackedWeightsStoreTest, SharedWhileUsed) {
+    const CpuBlockedMemoryDesc desc(Precision::FP32, Shape(VectorDims{2, 3}));
+    auto& store = PackedWeightsStore::getInstance();
+    const auto aliveEntries = store.size();
+    int created = 0;
+    auto create = [&]() {
+        created++;
+        return makeMemory(desc);
+    };
+
+    auto first = store.findOrCreate("PackedWeightsStoreTest_SharedWhileUsed", create);
+    auto second = store.findOrCreate("PackedWeightsStoreTest_SharedWhileUsed", create);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(created, 1);
+    ASSERT_EQ(store.size(), aliveEntries + 1);
+
+    // the store doesn't own the packed weights
+    first.reset();
+    second.reset();
+    ASSERT_EQ(store.size(), aliveEntries);
+    store.findOrCreate("PackedWeightsStoreTest_SharedWhileUsed", create);
+    ASSERT_EQ(created, 2);
+}
@@ -7,8 +7,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/budgeted_lru_cache.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 
 using namespace ov::intel_cpu;
 
@@ -96,6 +98,162 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(ShardedLruCacheTests, Get) {
+    constexpr size_t capacity = 64;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    size_t evicted = 0;
+    for (int i = 1; i <= 4 * capacity; ++i) {
+        ASSERT_NO_THROW(evicted += cache.put({i}, i));
+    }
+    ASSERT_EQ(evicted, 3 * capacity);
+
+    size_t found = 0;
+    for (int i = 1; i <= 4 * capacity; ++i) {
+        auto value = cache.get({i});
+        ASSERT_TRUE(value == int() || value == i);
+        found += value == i;
+    }
+    ASSERT_EQ(found, capacity);
+}
+
+TEST(ShardedLruCacheTests, SecondChancePolicy) {
+    // single shard to make the eviction order deterministic
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity, 1);
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i <= capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 24; ++i) {
+        ASSERT_EQ(cache.put({i}, i), 1);
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    for (int i = 4; i <= capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ShardedLruCacheTests, Evict) {
+    constexpr size_t capacity = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({10}, 10));
+    }
+    ASSERT_EQ(cache.get({10}), 10);
+    ASSERT_NO_THROW(cache.evict(5));
+    ASSERT_NO_THROW(cache.evict(10));
+    ASSERT_EQ(cache.get({10}), int());
+    ASSERT_NO_THROW(cache.evict(0));
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr size_t attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+namespace {
+struct SizedValue {
+    size_t getFootprint() const {
+        return size;
+    }
+
+    int data;
+    size_t size;
+};
+using SizedValuePtr = std::shared_ptr<SizedValue>;
+} // namespace
+
+TEST(BudgetedLruCacheTests, Footprint) {
+    ASSERT_EQ(getCacheFootprint(SizedValue{0, 10}), 10);
+    ASSERT_EQ(getCacheFootprint(std::make_shared<SizedValue>(SizedValue{0, 10})), 10);
+    ASSERT_EQ(getCacheFootprint(SizedValuePtr()), 0);
+    ASSERT_EQ(getCacheFootprint(10), cache_footprint::defaultFootprint);
+}
+
+TEST(BudgetedLruCacheTests, LruPolicyWithinBudget) {
+    constexpr size_t capacity = 100;
+    auto budget = std::make_shared<CacheBudget>(10 * 100);
+    BudgetedLruCache<IntKey, SizedValuePtr> cache(capacity, budget);
+    for (int i = 1; i <= 10; ++i) {
+        ASSERT_EQ(cache.put({i}, std::make_shared<SizedValue>(SizedValue{i, 100})), 0);
+    }
+    ASSERT_EQ(budget->getBytes(), 10 * 100);
+
+    for (int i = 4; i <= 10; ++i) {
+        ASSERT_EQ(cache.get({i})->data, i);
+    }
+
+    // the same cost per byte, so the least recently used are evicted
+    for (int i = 21; i < 24; ++i) {
+        ASSERT_EQ(cache.put({i}, std::make_shared<SizedValue>(SizedValue{i, 100})), 1);
+    }
+    ASSERT_EQ(budget->getBytes(), 10 * 100);
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), SizedValuePtr());
+    }
+    for (int i = 4; i <= 10; ++i) {
+        ASSERT_EQ(cache.get({i})->data, i);
+    }
+}
+
+TEST(BudgetedLruCacheTests, CostAwareEviction) {
+    constexpr size_t capacity = 100;
+    auto budget = std::make_shared<CacheBudget>(1000);
+    BudgetedLruCache<IntKey, SizedValuePtr> cache(capacity, budget);
+    // large and expensive to build
+    cache.put({1}, std::make_shared<SizedValue>(SizedValue{1, 500}), 5000.0);
+    // small and cheap
+    for (int i = 2; i <= 6; ++i) {
+        cache.put({i}, std::make_shared<SizedValue>(SizedValue{i, 100}), 10.0);
+    }
+    ASSERT_EQ(budget->getBytes(), 1000);
+
+    // the expensive record is the oldest one, but the cheap ones go first
+    cache.put({7}, std::make_shared<SizedValue>(SizedValue{7, 200}), 40.0);
+    ASSERT_LE(budget->getBytes(), 1000);
+    ASSERT_EQ(cache.get({1})->data, 1);
+    ASSERT_EQ(cache.get({7})->data, 7);
+    ASSERT_EQ(cache.get({2}), SizedValuePtr());
+    ASSERT_EQ(cache.get({3}), SizedValuePtr());
+}
+
+TEST(BudgetedLruCacheTests, SharedBudget) {
+    constexpr size_t capacity = 100;
+    auto budget = std::make_shared<CacheBudget>(1000);
+    {
+        BudgetedLruCache<IntKey, SizedValuePtr> cache1(capacity, budget);
+        BudgetedLruCache<IntKey, SizedValuePtr> cache2(capacity, budget);
+        for (int i = 1; i <= 10; ++i) {
+            cache1.put({i}, std::make_shared<SizedValue>(SizedValue{i, 100}));
+        }
+        // the records of the other cache are evicted to fit the budget
+        ASSERT_EQ(cache2.put({1}, std::make_shared<SizedValue>(SizedValue{1, 300}), 10.0), 3);
+        ASSERT_EQ(budget->getBytes(), 1000);
+        for (int i = 1; i <= 3; ++i) {
+            ASSERT_EQ(cache1.get({i}), SizedValuePtr());
+        }
+        cache2.evict(1);
+        ASSERT_EQ(budget->getBytes(), 700);
+    }
+    ASSERT_EQ(budget->getBytes(), 0);
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -379,3 +537,117 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    for (bool threadSafe : {false, true}) {
+        MultiCache cache(capacity, threadSafe);
+        for (int i = 0; i < 2 * capacity; ++i) {
+            cache.getOrCreate(IntKey{i}, intBuilder);
+        }
+        for (int i = capacity; i < 2 * capacity; ++i) {
+            cache.getOrCreate(IntKey{i}, intBuilder);
+        }
+
+        const auto& statistics = cache.getStatistics();
+        ASSERT_EQ(statistics.misses, 2 * capacity);
+        ASSERT_EQ(statistics.evictions, capacity);
+        ASSERT_EQ(statistics.hits + statistics.misses, 3 * capacity);
+    }
+}
+
+TEST(MultiCacheTests, SharedInstance) {
+    constexpr size_t capacity = 10;
+    auto cache = MultiCache::getSharedInstance(capacity);
+    ASSERT_EQ(cache, MultiCache::getSharedInstance(capacity));
+    ASSERT_NE(cache, MultiCache::getSharedInstance(capacity + 1));
+}
+
+TEST(MultiCacheTests, SmokeThreadSafe) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int numKeys = 100;
+    constexpr size_t capacity = numKeys / 2;  // to have the concurrent evictions as well
+    constexpr size_t numThreads = 30;
+
+    std::atomic<size_t> numBuilds{0};
+    auto intBuilder = [&](const IntKey& key) { ++numBuilds; return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { ++numBuilds; return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, true);
+
+    auto testRoutine = [&](size_t threadId) {
+        for (int n = 0; n < 10 * numKeys; ++n) {
+            const int i = static_cast<int>((n * 7 + threadId) % numKeys);
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+            auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+            ASSERT_NE(strResult.first, StrValueType());
+            ASSERT_EQ(*strResult.first, std::to_string(i));
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    const auto& statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, 2 * numThreads * 10 * numKeys);
+    ASSERT_EQ(statistics.misses, numBuilds);
+}
+
+TEST(MultiCacheTests, Budget) {
+    constexpr size_t capacity = 100;
+    constexpr size_t budget = 10 * cache_footprint::defaultFootprint;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, false, budget);
+    for (int i = 0; i < 20; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+        cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+        ASSERT_LE(cache.getBytes(), budget);
+    }
+    ASSERT_EQ(cache.getBytes(), budget);
+    ASSERT_EQ(cache.getStatistics().evictions, 30);
+}
+
+namespace {
+struct ReentrantValue {
+    static constexpr bool reentrant = true;
+    int data;
+};
+} // namespace
+
+TEST(MultiCacheTests, ReentrantValues) {
+    constexpr size_t capacity = 10;
+    auto statefulBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto reentrantBuilder = [&](const IntKey& key) { return std::make_shared<ReentrantValue>(ReentrantValue{key.data}); };
+
+    static_assert(IsReentrant<std::shared_ptr<ReentrantValue>>::value, "");
+    static_assert(!IsReentrant<std::shared_ptr<int>>::value, "");
+
+    // the streams share the reentrant values only
+    auto shared = std::make_shared<MultiCache>(capacity, true);
+    MultiCache stream0(capacity, false, 0, shared), stream1(capacity, false, 0, shared);
+    ASSERT_EQ(stream0.getOrCreate(IntKey{1}, reentrantBuilder).first, stream1.getOrCreate(IntKey{1}, reentrantBuilder).first);
+    ASSERT_NE(stream0.getOrCreate(IntKey{1}, statefulBuilder).first, stream1.getOrCreate(IntKey{1}, statefulBuilder).first);
+    ASSERT_EQ(stream0.getOrCreate(IntKey{1}, statefulBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(shared->getStatistics().hits, 1);
+
+    // the concurrent users of the cache get their own values with the state
+    MultiCache concurrent(capacity, false, 0, nullptr, false);
+    ASSERT_EQ(concurrent.getOrCreate(IntKey{1}, reentrantBuilder).first, concurrent.getOrCreate(IntKey{1}, reentrantBuilder).first);
+    auto stateful = concurrent.getOrCreate(IntKey{1}, statefulBuilder);
+    ASSERT_EQ(*stateful.first, 1);
+    ASSERT_NE(stateful.first, concurrent.getOrCreate(IntKey{1}, statefulBuilder).first);
+    ASSERT_EQ(concurrent.getStatistics().misses, 3);
+}
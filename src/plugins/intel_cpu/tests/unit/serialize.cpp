@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "serialize.h"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+std::shared_ptr<ov::Model> makeModel(size_t size) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, size});
+    std::vector<float> values(size);
+    std::iota(values.begin(), values.end(), 1.f);
+    auto constant = ov::opset8::Constant::create(ov::element::f32, {1, size}, values);
+    auto add = std::make_shared<ov::opset8::Add>(param, constant);
+    return std::make_shared<ov::Model>(ov::NodeVector{add}, ov::ParameterVector{param}, "Serialize");
+}
+
+// the name of the file mapped at the address, empty if the address isn't in a file mapping
+std::string mappedFile(const void* address) {
+#ifdef __linux__
+    std::ifstream maps("/proc/self/maps");
+    const auto addr = reinterpret_cast<uintptr_t>(address);
+    std::string line;
+    while (std::getline(maps, line)) {
+        std::istringstream fields(line);
+        std::string range, perms, offset, device, inode, path;
+        fields >> range >> perms >> offset >> device >> inode >> path;
+        const auto dash = range.find('-');
+        const auto begin = std::stoull(range.substr(0, dash), nullptr, 16);
+        const auto end = std::stoull(range.substr(dash + 1), nullptr, 16);
+        if (addr >= begin && addr < end)
+            return path;
+    }
+#endif
+    return {};
+}
+
+class SerializeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto prefix = CommonTestUtils::generateTestFilePrefix();
+        blobPath = prefix + "_blob.bin";
+        otherBlobPath = prefix + "_other_blob.bin";
+        model = makeModel(1024);
+        exportTo(blobPath, model);
+        exportTo(otherBlobPath, makeModel(2048));
+        referenceWeights = import(std::string{});
+        ASSERT_NE(referenceWeights, nullptr);
+    }
+
+    void TearDown() override {
+        std::remove(blobPath.c_str());
+        std::remove(otherBlobPath.c_str());
+    }
+
+    static void exportTo(const std::string& path, const std::shared_ptr<ov::Model>& model) {
+        std::ofstream stream(path, std::ios::binary);
+        CNNNetworkSerializer serializer(stream, nullptr);
+        serializer << CNNNetwork(model);
+    }
+
+    // imports the blob exported to blobPath, returns the weights passed to the network builder
+    Blob::CPtr import(const std::string& mappedPath) {
+        std::ifstream stream(blobPath, std::ios::binary);
+        Blob::CPtr weights;
+        CNNNetworkDeserializer deserializer(stream, [&](const std::string&, const Blob::CPtr& blob) {
+            weights = blob;
+            return CNNNetwork(model);
+        }, mappedPath);
+        CNNNetwork network;
+        deserializer >> network;
+        return weights;
+    }
+
+    void checkWeights(const Blob::CPtr& weights) const {
+        ASSERT_NE(weights, nullptr);
+        ASSERT_EQ(weights->byteSize(), referenceWeights->byteSize());
+        ASSERT_EQ(std::memcmp(weights->cbuffer().as<const uint8_t*>(), referenceWeights->cbuffer().as<const uint8_t*>(),
+                              weights->byteSize()), 0);
+    }
+
+    std::string blobPath;
+    std::string otherBlobPath;
+    std::shared_ptr<ov::Model> model;
+    Blob::CPtr referenceWeights;
+};
+}   // namespace
+
+TEST_F(SerializeTest, MappedWeights) {
+    const auto weights = import(blobPath);
+    checkWeights(weights);
+#ifdef __linux__
+    ASSERT_NE(mappedFile(weights->cbuffer().as<const void*>()).find(blobPath), std::string::npos);
+#endif
+}
+
+// the data header of the mapped file doesn't match the stream, the weights are read from the stream
+TEST_F(SerializeTest, HeaderMismatchFallback) {
+    const auto weights = import(otherBlobPath);
+    checkWeights(weights);
+    ASSERT_EQ(mappedFile(weights->cbuffer().as<const void*>()).find(otherBlobPath), std::string::npos);
+}
+
+TEST_F(SerializeTest, MissingFileFallback) {
+    checkWeights(import(blobPath + ".missing"));
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "nodes/subgraph.h"
+#include "plugin.h"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+// three Add -> Multiply -> Relu chains tokenized into snippets, the first two differ only in the input
+std::shared_ptr<ov::Model> makeModel() {
+    const std::vector<size_t> inputShape = {1, 16, 8, 8};
+    auto inputParams = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, inputShape, inputShape});
+
+    auto makeChain = [](const std::shared_ptr<ngraph::Node>& param, float scalar) {
+        auto constant = ngraph::builder::makeConstant(ngraph::element::f32, {1}, std::vector<float>{scalar});
+        auto add = std::make_shared<ngraph::opset3::Add>(param, constant);
+        auto mul = std::make_shared<ngraph::opset3::Multiply>(add, param);
+        auto relu = std::make_shared<ngraph::opset3::Relu>(mul);
+        return std::make_shared<ngraph::opset3::Result>(relu);
+    };
+
+    ngraph::ResultVector results{makeChain(inputParams[0], 1.f),
+                                 makeChain(inputParams[1], 1.f),
+                                 makeChain(inputParams[2], 2.f)};
+    return std::make_shared<ov::Model>(results, inputParams, "SnippetsKernelSharing");
+}
+}   // namespace
+
+TEST(SnippetsKernelSharingTest, IdenticalSubgraphsShareKernel) {
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2))
+        GTEST_SKIP() << "Snippets aren't generated without avx2";
+
+    auto engine = std::make_shared<Engine>();
+    const auto aliveKernels = node::Snippet::sharedKernelsCount();
+
+    auto first = engine->LoadNetwork(CNNNetwork(makeModel()), {});
+    // the first two subgraphs share the kernel, the third one has another scalar
+    ASSERT_EQ(node::Snippet::sharedKernelsCount(), aliveKernels + 2);
+
+    // the subgraphs of another compiled model reuse the kernels
+    auto second = engine->LoadNetwork(CNNNetwork(makeModel()), {});
+    ASSERT_EQ(node::Snippet::sharedKernelsCount(), aliveKernels + 2);
+
+    // the kernels are released with the last compiled model using them
+    first.reset();
+    ASSERT_EQ(node::Snippet::sharedKernelsCount(), aliveKernels + 2);
+    second.reset();
+    ASSERT_EQ(node::Snippet::sharedKernelsCount(), aliveKernels);
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "cache/warmup_cache.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+using InputShapes = WarmupCache::InputShapes;
+
+class WarmupCacheTests : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(WarmupCache(".", key).getPath().c_str());
+    }
+
+    const std::string key = "WarmupCacheTests model";
+};
+}   // namespace
+
+TEST_F(WarmupCacheTests, RecordAndReload) {
+    const std::vector<InputShapes> shapes = {{{1, 3, 224, 224}, {1, 10}},
+                                             {{2, 3, 224, 224}, {2, 10}},
+                                             {{4, 3, 320, 320}, {}}};
+    {
+        WarmupCache cache(".", key);
+        ASSERT_TRUE(cache.getShapes().empty());
+        for (const auto& item : shapes) {
+            ASSERT_TRUE(cache.record(item));
+        }
+        // already recorded
+        ASSERT_FALSE(cache.record(shapes[1]));
+        ASSERT_EQ(cache.getShapes(), shapes);
+    }
+
+    WarmupCache cache(".", key);
+    ASSERT_EQ(cache.getShapes(), shapes);
+}
+
+TEST_F(WarmupCacheTests, Capacity) {
+    {
+        WarmupCache cache(".", key, 2);
+        ASSERT_TRUE(cache.record({{1, 1}}));
+        ASSERT_TRUE(cache.record({{2, 2}}));
+        ASSERT_FALSE(cache.record({{3, 3}}));
+    }
+
+    WarmupCache cache(".", key, 1);
+    ASSERT_EQ(cache.getShapes(), (std::vector<InputShapes>{{{1, 1}}}));
+}
+
+TEST_F(WarmupCacheTests, IgnoresForeignAndBrokenRecords) {
+    {
+        WarmupCache cache(".", key);
+        ASSERT_TRUE(cache.record({{1, 16}}));
+    }
+    WarmupCache other(".", "another model");
+    ASSERT_NE(other.getPath(), WarmupCache(".", key).getPath());
+    ASSERT_TRUE(other.getShapes().empty());
+
+    const auto path = WarmupCache(".", key).getPath();
+    {
+        std::ofstream file(path, std::ios::app);
+        file << "1,x,3\n" << "99999999999999999999999\n" << "8,16\n";
+    }
+    WarmupCache cache(".", key);
+    ASSERT_EQ(cache.getShapes(), (std::vector<InputShapes>{{{1, 16}}, {{8, 16}}}));
+
+    // the key mismatch invalidates the file
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "OV_CPU_WARMUP_CACHE 1\n" << "another model\n" << "1,16\n";
+    }
+    ASSERT_TRUE(WarmupCache(".", key).getShapes().empty());
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(WeightsHashTests, ReferenceValues) {
+    const auto& hasher = WeightsSharing::GetHashFunc();
+    const std::string text = "Nobody inspects the spammish repetition";
+
+    ASSERT_EQ(hasher.hash(reinterpret_cast<const unsigned char*>(text.data()), 0), 0xEF46DB3751D8E999ULL);
+    ASSERT_EQ(hasher.hash(reinterpret_cast<const unsigned char*>(text.data()), text.size()), 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST(WeightsHashTests, LargeBufferIsStable) {
+    const auto& hasher = WeightsSharing::GetHashFunc();
+    // not a multiple of the chunk size to cover the tail chunk
+    std::vector<unsigned char> data(3 * SimpleDataHash::kChunkSize + 123);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+
+    const auto reference = hasher.hash(data.data(), data.size());
+    ASSERT_EQ(reference, hasher.hash(data.data(), data.size()));
+
+    data[2 * SimpleDataHash::kChunkSize + 5] ^= 1;
+    ASSERT_NE(reference, hasher.hash(data.data(), data.size()));
+
+    data[2 * SimpleDataHash::kChunkSize + 5] ^= 1;
+    ASSERT_NE(reference, hasher.hash(data.data(), data.size() - 1));
+}
@@ -50,6 +50,10 @@ protected:
     size_t num_requests;
     size_t num_batch;
     std::vector<std::shared_ptr<ngraph::Function>> fn_ptrs;
+    std::map<std::string, std::string> extra_config;
+    bool check_execution_stats = false;
+    // the smaller batches excluded from the ladder, like the ones failed to compile
+    std::vector<size_t> missing_partial_batches;
 
     void TestAutoBatch() {
         std::vector<InferenceEngine::CNNNetwork> nets;
@@ -60,6 +64,7 @@ protected:
         auto ie = InferenceEngine::Core();
         std::vector<std::string> outputs;
         std::vector<InferRequest> irs;
+        std::vector<ExecutableNetwork> exec_nets;
         std::vector<std::vector<uint8_t>> ref;
         std::vector<int> outElementsCount;
 
@@ -81,9 +86,11 @@ protected:
             }
             // minimize timeout to reduce test time
             config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+            config.insert(extra_config.begin(), extra_config.end());
             auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
                                                     target_device + "(" + std::to_string(num_batch) + ")",
                                                config);
+            exec_nets.push_back(exec_net_ref);
 
             auto network_outputs = net.getOutputsInfo();
             ASSERT_EQ(network_outputs.size(), 1) << " Auto-Batching tests use networks with single output";
@@ -141,6 +148,66 @@ protected:
                                              outElementsCount[i],
                                              thr);
         }
+
+        if (!check_execution_stats)
+            return;
+        // every request is accounted exactly once, whatever batch was used to execute it
+        for (auto& exec_net : exec_nets) {
+            const auto stats = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_EXECUTION_STATS))
+                                   .as<std::map<std::string, uint64_t>>();
+            uint64_t executed = 0;
+            for (const auto& s : stats) {
+                if (s.first.find("batch_") != 0)
+                    continue;
+                const auto batch = std::stoul(s.first.substr(std::string("batch_").size()));
+                executed += batch * s.second;
+                // the smaller batches execute the collected requests on the timeout, each one at most once
+                if (batch > 1 && batch < num_batch)
+                    ASSERT_LE(s.second, stats.at("timeouts")) << s.first;
+            }
+            for (const auto& batch : missing_partial_batches)
+                ASSERT_EQ(stats.count("batch_" + std::to_string(batch)), 0);
+            ASSERT_EQ(executed, num_requests * niter);
+
+            const auto fill_ratio = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_FILL_RATIO)).as<float>();
+            ASSERT_GE(fill_ratio, 0.f);
+            ASSERT_LE(fill_ratio, 1.f);
+            ASSERT_EQ(stats.at("timeouts"), exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_TIMEOUTS_FIRED)).as<uint64_t>());
+            ASSERT_GE(exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_CURRENT_TIMEOUT)).as<float>(), 0.f);
+        }
+    }
+};
+
+class AutoBatching_Test_PartialBatches : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        std::tie(target_device, use_get_blob, num_streams, num_requests, num_batch) = this->GetParam();
+        fn_ptrs = {ngraph::builder::subgraph::makeSingleConv(),
+                   ngraph::builder::subgraph::makeMultiSingleConv()};
+        extra_config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = CONFIG_VALUE(YES);
+        check_execution_stats = true;
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return "PartialBatches_" + AutoBatching_Test::getTestCaseName(obj);
+    }
+};
+
+// the ladder misses the batches between 2 and the device batch, so the batch 2 fits the collected requests repeatedly
+class AutoBatching_Test_MissingPartialBatches : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        std::tie(target_device, use_get_blob, num_streams, num_requests, num_batch) = this->GetParam();
+        fn_ptrs = {ngraph::builder::subgraph::makeSingleConv(),
+                   ngraph::builder::subgraph::makeMultiSingleConv()};
+        extra_config[CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCHES)] = "2";
+        for (size_t batch = 4; batch < num_batch; batch *= 2)
+            missing_partial_batches.push_back(batch);
+        check_execution_stats = true;
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return "MissingPartialBatches_" + AutoBatching_Test::getTestCaseName(obj);
     }
 };
 
@@ -163,6 +230,21 @@ public:
     }
 };
 
+class AutoBatching_Test_LatencyTarget : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        std::tie(target_device, use_get_blob, num_streams, num_requests, num_batch) = this->GetParam();
+        fn_ptrs = {ngraph::builder::subgraph::makeSingleConv(),
+                   ngraph::builder::subgraph::makeMultiSingleConv()};
+        extra_config[CONFIG_KEY(AUTO_BATCH_LATENCY_TARGET)] = std::to_string(50);
+        check_execution_stats = true;
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return "LatencyTarget_" + AutoBatching_Test::getTestCaseName(obj);
+    }
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -171,4 +253,16 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test_PartialBatches, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+}
+
+TEST_P(AutoBatching_Test_MissingPartialBatches, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+}
+
+TEST_P(AutoBatching_Test_LatencyTarget, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+}
+
 }  // namespace AutoBatchingTests